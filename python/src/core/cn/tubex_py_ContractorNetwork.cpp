@@ -19,6 +19,7 @@
 #include "tubex_ContractorNetwork.h"
 // Generated file from Doxygen XML (doxygen2docstring.py):
 #include "tubex_py_ContractorNetwork_docs.h"
+#include "tubex_py_CancellationToken_docs.h"
 
 using namespace std;
 using namespace ibex;
@@ -89,8 +90,46 @@ vector<tubex::Domain> pylist_to_vectordomains(py::list lst)
   return domains;
 }
 
+double contract_without_gil(ContractorNetwork& cn, double dt, bool verbose, const CancellationToken *token)
+{
+  // The GIL is released during the propagation, so that other Python threads
+  // can run (and possibly cancel the token); Python contractors reacquire it
+  cn.set_cancellation_token(token);
+  double t;
+
+  try
+  {
+    py::gil_scoped_release release;
+    t = cn.contract_during(dt, verbose);
+  }
+
+  catch(...)
+  {
+    cn.set_cancellation_token(NULL);
+    throw;
+  }
+
+  cn.set_cancellation_token(NULL);
+  return t;
+}
+
 void export_ContractorNetwork(py::module& m)
 {
+  py::class_<CancellationToken>(m, "CancellationToken", CANCELLATIONTOKEN_MAIN)
+
+    .def(py::init<>(),
+      CANCELLATIONTOKEN_CANCELLATIONTOKEN)
+
+    .def("cancel", &CancellationToken::cancel,
+      CANCELLATIONTOKEN_VOID_CANCEL)
+
+    .def("reset", &CancellationToken::reset,
+      CANCELLATIONTOKEN_VOID_RESET)
+
+    .def("is_cancelled", &CancellationToken::is_cancelled,
+      CANCELLATIONTOKEN_BOOL_IS_CANCELLED)
+  ;
+
   py::class_<ContractorNetwork> cn(m, "ContractorNetwork", CONTRACTORNETWORK_MAIN);
   cn
 
@@ -173,13 +212,19 @@ void export_ContractorNetwork(py::module& m)
 
   // Contraction process  
 
-    .def("contract", &ContractorNetwork::contract,
+    .def("contract", [](ContractorNetwork& cn, bool verbose, const CancellationToken *token)
+      {
+        return contract_without_gil(cn, numeric_limits<double>::infinity(), verbose, token);
+      },
       CONTRACTORNETWORK_DOUBLE_CONTRACT_BOOL,
-      "verbose"_a=false)
+      "verbose"_a=false, "token"_a=nullptr)
 
-    .def("contract_during", &ContractorNetwork::contract_during,
+    .def("contract_during", [](ContractorNetwork& cn, double dt, bool verbose, const CancellationToken *token)
+      {
+        return contract_without_gil(cn, dt, verbose, token);
+      },
       CONTRACTORNETWORK_DOUBLE_CONTRACT_DURING_DOUBLE_BOOL,
-      "dt"_a, "verbose"_a=false)
+      "dt"_a, "verbose"_a=false, "token"_a=nullptr)
 
     .def("set_fixedpoint_ratio", &ContractorNetwork::set_fixedpoint_ratio,
       CONTRACTORNETWORK_VOID_SET_FIXEDPOINT_RATIO_FLOAT,
@@ -41,26 +41,32 @@ void export_CtcEval(py::module& m, py::class_<DynCtc, pyDynCtc>& dyn_ctc)
 
     .def("contract", (void (CtcEval::*)(double,Interval&,Tube&,Tube&))&CtcEval::contract,
       CTCEVAL_VOID_CONTRACT_DOUBLE_INTERVAL_TUBE_TUBE,
-      "t"_a.noconvert(), "z"_a.noconvert(), "y"_a.noconvert(), "w"_a.noconvert())
+      "t"_a.noconvert(), "z"_a.noconvert(), "y"_a.noconvert(), "w"_a.noconvert(),
+      py::call_guard<py::gil_scoped_release>())
 
     .def("contract", (void (CtcEval::*)(Interval&,Interval&,Tube&,Tube&))&CtcEval::contract,
       CTCEVAL_VOID_CONTRACT_INTERVAL_INTERVAL_TUBE_TUBE,
-      "t"_a.noconvert(), "z"_a.noconvert(), "y"_a.noconvert(), "w"_a.noconvert())
+      "t"_a.noconvert(), "z"_a.noconvert(), "y"_a.noconvert(), "w"_a.noconvert(),
+      py::call_guard<py::gil_scoped_release>())
 
     .def("contract", (void (CtcEval::*)(double,IntervalVector&,TubeVector&,TubeVector&))&CtcEval::contract,
       CTCEVAL_VOID_CONTRACT_DOUBLE_INTERVALVECTOR_TUBEVECTOR_TUBEVECTOR,
-      "t"_a.noconvert(), "z"_a.noconvert(), "y"_a.noconvert(), "w"_a.noconvert())
+      "t"_a.noconvert(), "z"_a.noconvert(), "y"_a.noconvert(), "w"_a.noconvert(),
+      py::call_guard<py::gil_scoped_release>())
     
     .def("contract", (void (CtcEval::*)(Interval&,IntervalVector&,TubeVector&,TubeVector&))&CtcEval::contract,
       CTCEVAL_VOID_CONTRACT_INTERVAL_INTERVALVECTOR_TUBEVECTOR_TUBEVECTOR,
-      "t"_a.noconvert(), "z"_a.noconvert(), "y"_a.noconvert(), "w"_a.noconvert())
+      "t"_a.noconvert(), "z"_a.noconvert(), "y"_a.noconvert(), "w"_a.noconvert(),
+      py::call_guard<py::gil_scoped_release>())
     
     .def("contract", (void (CtcEval::*)(Interval &,Interval &,const Tube&))&CtcEval::contract,
       CTCEVAL_VOID_CONTRACT_INTERVAL_INTERVAL_TUBE,
-      "t"_a.noconvert(), "z"_a.noconvert(), "y"_a.noconvert())
+      "t"_a.noconvert(), "z"_a.noconvert(), "y"_a.noconvert(),
+      py::call_guard<py::gil_scoped_release>())
     
     .def("contract", (void (CtcEval::*)(Interval &,IntervalVector &,const TubeVector&))&CtcEval::contract,
       CTCEVAL_VOID_CONTRACT_INTERVAL_INTERVALVECTOR_TUBEVECTOR,
-      "t"_a.noconvert(), "z"_a.noconvert(), "y"_a.noconvert())
+      "t"_a.noconvert(), "z"_a.noconvert(), "y"_a.noconvert(),
+      py::call_guard<py::gil_scoped_release>())
   ;
 }
\ No newline at end of file
@@ -38,11 +38,13 @@ void export_CtcPicard(py::module& m, py::class_<DynCtc, pyDynCtc>& dyn_ctc)
 
     .def("contract", (void (CtcPicard::*)(const TFnc&,Tube&,TimePropag))&CtcPicard::contract,
       CTCPICARD_VOID_CONTRACT_TFNC_TUBE_TIMEPROPAG,
-      "f"_a, "x"_a.noconvert(), "t_propa"_a=TimePropag::FORWARD|TimePropag::BACKWARD)
+      "f"_a, "x"_a.noconvert(), "t_propa"_a=TimePropag::FORWARD|TimePropag::BACKWARD,
+      py::call_guard<py::gil_scoped_release>())
 
     .def("contract", (void (CtcPicard::*)(const TFnc&,TubeVector&,TimePropag) )&CtcPicard::contract,
       CTCPICARD_VOID_CONTRACT_TFNC_TUBEVECTOR_TIMEPROPAG,
-      "f"_a, "x"_a.noconvert(), "t_propa"_a=TimePropag::FORWARD|TimePropag::BACKWARD)
+      "f"_a, "x"_a.noconvert(), "t_propa"_a=TimePropag::FORWARD|TimePropag::BACKWARD,
+      py::call_guard<py::gil_scoped_release>())
 
     .def("picard_iterations", &CtcPicard::picard_iterations,
       CTCPICARD_INT_PICARD_ITERATIONS)
@@ -50,35 +50,43 @@ void export_CtcFunction(py::module& m)
 
     .def("contract", (void (CtcFunction::*)(IntervalVector&))&CtcFunction::contract,
       CTCFUNCTION_VOID_CONTRACT_INTERVALVECTOR,
-      "x"_a.noconvert())
+      "x"_a.noconvert(),
+      py::call_guard<py::gil_scoped_release>())
 
     .def("contract", (void (CtcFunction::*)(TubeVector&))&CtcFunction::contract,
       CTCFUNCTION_VOID_CONTRACT_TUBEVECTOR,
-      "x"_a.noconvert())
+      "x"_a.noconvert(),
+      py::call_guard<py::gil_scoped_release>())
 
     .def("contract", (void (CtcFunction::*)(Tube&))&CtcFunction::contract,
       CTCFUNCTION_VOID_CONTRACT_TUBE,
-      "x1"_a.noconvert())
+      "x1"_a.noconvert(),
+      py::call_guard<py::gil_scoped_release>())
 
     .def("contract", (void (CtcFunction::*)(Tube&,Tube&))&CtcFunction::contract,
       CTCFUNCTION_VOID_CONTRACT_TUBE_TUBE,
-      "x1"_a.noconvert(), "x2"_a.noconvert())
+      "x1"_a.noconvert(), "x2"_a.noconvert(),
+      py::call_guard<py::gil_scoped_release>())
 
     .def("contract", (void (CtcFunction::*)(Tube&,Tube&,Tube&))&CtcFunction::contract,
       CTCFUNCTION_VOID_CONTRACT_TUBE_TUBE_TUBE,
-      "x1"_a.noconvert(), "x2"_a.noconvert(), "x3"_a.noconvert())
+      "x1"_a.noconvert(), "x2"_a.noconvert(), "x3"_a.noconvert(),
+      py::call_guard<py::gil_scoped_release>())
 
     .def("contract", (void (CtcFunction::*)(Tube&,Tube&,Tube&,Tube&))&CtcFunction::contract,
       CTCFUNCTION_VOID_CONTRACT_TUBE_TUBE_TUBE_TUBE,
-      "x1"_a.noconvert(), "x2"_a.noconvert(), "x3"_a.noconvert(), "x4"_a.noconvert())
+      "x1"_a.noconvert(), "x2"_a.noconvert(), "x3"_a.noconvert(), "x4"_a.noconvert(),
+      py::call_guard<py::gil_scoped_release>())
 
     .def("contract", (void (CtcFunction::*)(Tube&,Tube&,Tube&,Tube&,Tube&))&CtcFunction::contract,
       CTCFUNCTION_VOID_CONTRACT_TUBE_TUBE_TUBE_TUBE_TUBE,
-      "x1"_a.noconvert(), "x2"_a.noconvert(), "x3"_a.noconvert(), "x4"_a.noconvert(), "x5"_a.noconvert())
+      "x1"_a.noconvert(), "x2"_a.noconvert(), "x3"_a.noconvert(), "x4"_a.noconvert(), "x5"_a.noconvert(),
+      py::call_guard<py::gil_scoped_release>())
 
     .def("contract", (void (CtcFunction::*)(Tube&,Tube&,Tube&,Tube&,Tube&,Tube&))&CtcFunction::contract,
       CTCFUNCTION_VOID_CONTRACT_TUBE_TUBE_TUBE_TUBE_TUBE_TUBE,
-      "x1"_a.noconvert(), "x2"_a.noconvert(), "x3"_a.noconvert(), "x4"_a.noconvert(), "x5"_a.noconvert(), "x6"_a.noconvert())
+      "x1"_a.noconvert(), "x2"_a.noconvert(), "x3"_a.noconvert(), "x4"_a.noconvert(), "x5"_a.noconvert(), "x6"_a.noconvert(),
+      py::call_guard<py::gil_scoped_release>())
 
     //.def("contract", (void (CtcFunction::*)(Slice **))&CtcFunction::contract,
     //    CTCFUNCTION_VOID_CONTRACT_SLICE, "v_x_slices"_a)
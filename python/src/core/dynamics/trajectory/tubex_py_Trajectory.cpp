@@ -14,6 +14,7 @@
 #include <pybind11/stl.h>
 #include <pybind11/operators.h>
 #include <pybind11/functional.h>
+#include <pybind11/numpy.h>
 #include "pyIbex_type_caster.h"
 
 #include "tubex_Trajectory.h"
@@ -26,6 +27,39 @@ using namespace tubex;
 namespace py = pybind11;
 using namespace pybind11::literals;
 
+typedef py::array_t<double,py::array::c_style|py::array::forcecast> ArrayDouble;
+
+// NumPy arrays of samples: the values being stored in a map, they cannot
+// be shared with NumPy, but arrays are read or filled in a single C++ pass
+
+Trajectory* create_trajectory_from_arrays(const ArrayDouble& t, const ArrayDouble& y)
+{
+  if(t.ndim() != 1 || y.ndim() != 1 || t.shape(0) != y.shape(0) || t.shape(0) < 1)
+    throw invalid_argument("t and y must be 1d arrays of same non-zero size");
+
+  auto r_t = t.unchecked<1>();
+  auto r_y = y.unchecked<1>();
+
+  map<double,double> map_values;
+  for(size_t i = 0 ; i < (size_t)t.shape(0) ; i++)
+    map_values.emplace_hint(map_values.end(), r_t(i), r_y(i)); // constant time for sorted dates
+
+  return new Trajectory(map_values);
+}
+
+py::array_t<double> trajectory_samples_array(const Trajectory& x)
+{
+  const map<double,double>& map_values = x.sampled_map();
+  py::array_t<double> a(vector<size_t>({ map_values.size(), 2 }));
+  auto r = a.mutable_unchecked<2>();
+  size_t i = 0;
+  for(const auto& it : map_values)
+  {
+    r(i,0) = it.first; r(i,1) = it.second;
+    i++;
+  }
+  return a;
+}
 
 void export_Trajectory(py::module& m)
 {
@@ -53,6 +87,12 @@ void export_Trajectory(py::module& m)
       TRAJECTORY_TRAJECTORY_TRAJECTORY,
       "traj"_a)
 
+    // Used instead of .def(py::init<const map<double,double>&>(), from NumPy arrays of dates t
+    // and values y, preferably sorted by dates
+    .def(py::init(&create_trajectory_from_arrays),
+      TRAJECTORY_TRAJECTORY_MAPDOUBLEDOUBLE,
+      "t"_a, "y"_a)
+
     .def("size", &Trajectory::size,
       TRAJECTORY_INT_SIZE)
 
@@ -68,6 +108,10 @@ void export_Trajectory(py::module& m)
     .def("sampled_map", &Trajectory::sampled_map,
       TRAJECTORY_CONSTMAPDOUBLEDOUBLE_SAMPLED_MAP)
 
+    // (nb_samples,2) NumPy array of (t,y) pairs
+    .def("samples_array", &trajectory_samples_array,
+      TRAJECTORY_CONSTMAPDOUBLEDOUBLE_SAMPLED_MAP)
+
     .def("tfunction", &Trajectory::tfunction,
       TRAJECTORY_CONSTTFUNCTION_TFUNCTION,
       py::return_value_policy::reference_internal)
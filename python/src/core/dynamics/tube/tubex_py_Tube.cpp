@@ -14,6 +14,7 @@
 #include <pybind11/stl.h>
 #include <pybind11/operators.h>
 #include <pybind11/functional.h>
+#include <pybind11/numpy.h>
 #include "pyIbex_type_caster.h"
 
 #include "tubex_Tube.h"
@@ -26,6 +27,81 @@ using namespace tubex;
 namespace py = pybind11;
 using namespace pybind11::literals;
 
+typedef py::array_t<double,py::array::c_style|py::array::forcecast> ArrayDouble;
+
+// NumPy arrays of bounds: the slices being chained objects, their data cannot
+// be shared with NumPy, but arrays are read or filled in a single C++ pass
+
+Tube* create_tube_from_arrays(const ArrayDouble& t, const ArrayDouble& codomains, const py::object& gates)
+{
+  if(t.ndim() != 1 || t.shape(0) < 2)
+    throw invalid_argument("t must be a 1d array of at least two dates");
+
+  size_t n = t.shape(0) - 1;
+  if(codomains.ndim() != 2 || (size_t)codomains.shape(0) != n || codomains.shape(1) != 2)
+    throw invalid_argument("codomains must be a (nb_slices,2) array of bounds");
+
+  auto r_t = t.unchecked<1>();
+  auto r_codomains = codomains.unchecked<2>();
+
+  vector<Interval> v_tdomains(n), v_codomains(n);
+  for(size_t i = 0 ; i < n ; i++)
+  {
+    if(!(r_t(i) < r_t(i+1)))
+      throw invalid_argument("dates of t must be strictly increasing");
+    v_tdomains[i] = Interval(r_t(i), r_t(i+1));
+    v_codomains[i] = Interval(r_codomains(i,0), r_codomains(i,1));
+  }
+
+  Tube *x = new Tube(v_tdomains, v_codomains);
+
+  if(!gates.is_none())
+  {
+    ArrayDouble a_gates = gates.cast<ArrayDouble>();
+    if(a_gates.ndim() != 2 || (size_t)a_gates.shape(0) != n+1 || a_gates.shape(1) != 2)
+    {
+      delete x;
+      throw invalid_argument("gates must be a (nb_slices+1,2) array of bounds");
+    }
+
+    auto r_gates = a_gates.unchecked<2>();
+    size_t i = 0;
+    for(Slice *s = x->first_slice() ; s != NULL ; s = s->next_slice())
+    {
+      s->set_input_gate(Interval(r_gates(i,0), r_gates(i,1)));
+      i++;
+    }
+    x->last_slice()->set_output_gate(Interval(r_gates(n,0), r_gates(n,1)));
+  }
+
+  return x;
+}
+
+py::array_t<double> intervals_array(const vector<Interval>& v_x)
+{
+  py::array_t<double> a(vector<size_t>({ v_x.size(), 2 }));
+  auto r = a.mutable_unchecked<2>();
+  for(size_t i = 0 ; i < v_x.size() ; i++)
+  {
+    r(i,0) = v_x[i].lb(); r(i,1) = v_x[i].ub();
+  }
+  return a;
+}
+
+py::array_t<double> tube_tdomains_array(const Tube& x)
+{
+  return intervals_array(x.tdomains());
+}
+
+py::array_t<double> tube_codomains_array(const Tube& x)
+{
+  return intervals_array(x.codomains());
+}
+
+py::array_t<double> tube_gates_array(const Tube& x)
+{
+  return intervals_array(x.gates());
+}
 
 void export_Tube(py::module& m)
 {
@@ -74,6 +150,12 @@ void export_Tube(py::module& m)
       TUBE_TUBE_STRING,
       "binary_file_name"_a)
 
+    // Used instead of .def(py::init<const vector<Interval>&,const vector<Interval>&>(), from NumPy arrays:
+    // the nb_slices+1 dates t, the (nb_slices,2) codomains bounds and the (nb_slices+1,2) gates bounds
+    .def(py::init(&create_tube_from_arrays),
+      TUBE_TUBE_VECTORINTERVAL_VECTORINTERVAL,
+      "t"_a, "codomains"_a, "gates"_a=py::none())
+
     //.def(py::init<const string&,Trajectory * &>(),
     //  TUBE_TUBE_STRING_TRAJECTORY,
     //  "binary_file_name"_a, "traj"_a)
@@ -359,6 +441,18 @@ void export_Tube(py::module& m)
     .def("__iand__", [](Tube& s,const Tube& o) { return s &= o; },
       TUBE_CONSTTUBE_OPERATORINTEQ_TUBE)
 
+  // NumPy arrays
+
+    // (nb_slices,2), (nb_slices,2) and (nb_slices+1,2) NumPy arrays of bounds
+    .def("tdomains_array", &tube_tdomains_array,
+      TUBE_CONSTVECTORINTERVAL_TDOMAINS)
+
+    .def("codomains_array", &tube_codomains_array,
+      TUBE_CONSTVECTORINTERVAL_CODOMAINS)
+
+    .def("gates_array", &tube_gates_array,
+      TUBE_CONSTVECTORINTERVAL_GATES)
+
   // String
 
     .def("class_name", &Tube::class_name,
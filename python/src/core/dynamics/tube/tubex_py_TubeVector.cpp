@@ -14,6 +14,7 @@
 #include <pybind11/stl.h>
 #include <pybind11/operators.h>
 #include <pybind11/functional.h>
+#include <pybind11/numpy.h>
 #include "pyIbex_type_caster.h"
 
 #include "tubex_TubeVector.h"
@@ -38,6 +39,107 @@ TubeVector* create_tubevector_from_list(py::list& lst)
   return instance;
 }
 
+typedef py::array_t<double,py::array::c_style|py::array::forcecast> ArrayDouble;
+
+// NumPy arrays of bounds: the slices being chained objects, their data cannot
+// be shared with NumPy, but arrays are read or filled in a single C++ pass
+
+TubeVector* create_tubevector_from_arrays(const ArrayDouble& t, const ArrayDouble& codomains, const py::object& gates)
+{
+  if(t.ndim() != 1 || t.shape(0) < 2)
+    throw invalid_argument("t must be a 1d array of at least two dates");
+
+  size_t n = t.shape(0) - 1;
+  if(codomains.ndim() != 3 || (size_t)codomains.shape(0) != n || codomains.shape(1) < 1 || codomains.shape(2) != 2)
+    throw invalid_argument("codomains must be a (nb_slices,n,2) array of bounds");
+
+  int dim = codomains.shape(1);
+  auto r_t = t.unchecked<1>();
+  auto r_codomains = codomains.unchecked<3>();
+
+  vector<Interval> v_tdomains(n);
+  vector<IntervalVector> v_codomains(n, IntervalVector(dim));
+  for(size_t i = 0 ; i < n ; i++)
+  {
+    if(!(r_t(i) < r_t(i+1)))
+      throw invalid_argument("dates of t must be strictly increasing");
+    v_tdomains[i] = Interval(r_t(i), r_t(i+1));
+    for(int j = 0 ; j < dim ; j++)
+      v_codomains[i][j] = Interval(r_codomains(i,j,0), r_codomains(i,j,1));
+  }
+
+  TubeVector *x = new TubeVector(v_tdomains, v_codomains);
+
+  if(!gates.is_none())
+  {
+    ArrayDouble a_gates = gates.cast<ArrayDouble>();
+    if(a_gates.ndim() != 3 || (size_t)a_gates.shape(0) != n+1 || a_gates.shape(1) != dim || a_gates.shape(2) != 2)
+    {
+      delete x;
+      throw invalid_argument("gates must be a (nb_slices+1,n,2) array of bounds");
+    }
+
+    auto r_gates = a_gates.unchecked<3>();
+    for(int j = 0 ; j < dim ; j++)
+    {
+      size_t i = 0;
+      for(Slice *s = (*x)[j].first_slice() ; s != NULL ; s = s->next_slice())
+      {
+        s->set_input_gate(Interval(r_gates(i,j,0), r_gates(i,j,1)));
+        i++;
+      }
+      (*x)[j].last_slice()->set_output_gate(Interval(r_gates(n,j,0), r_gates(n,j,1)));
+    }
+  }
+
+  return x;
+}
+
+void check_same_slicing(const TubeVector& x)
+{
+  // The arrays are of size nb_slices for all the components
+  if(!TubeVector::same_slicing(x, x[0]))
+    throw py::value_error("the components of the tube vector must have the same slicing");
+}
+
+py::array_t<double> tubevector_tdomains_array(const TubeVector& x)
+{
+  check_same_slicing(x);
+  const vector<Interval> v_tdomains = x.tdomains();
+
+  py::array_t<double> a(vector<size_t>({ v_tdomains.size(), 2 }));
+  auto r = a.mutable_unchecked<2>();
+  for(size_t i = 0 ; i < v_tdomains.size() ; i++)
+  {
+    r(i,0) = v_tdomains[i].lb(); r(i,1) = v_tdomains[i].ub();
+  }
+  return a;
+}
+
+py::array_t<double> intervalvectors_array(const vector<IntervalVector>& v_x, int n)
+{
+  py::array_t<double> a(vector<size_t>({ v_x.size(), (size_t)n, 2 }));
+  auto r = a.mutable_unchecked<3>();
+  for(size_t i = 0 ; i < v_x.size() ; i++)
+    for(int j = 0 ; j < n ; j++)
+    {
+      r(i,j,0) = v_x[i][j].lb(); r(i,j,1) = v_x[i][j].ub();
+    }
+  return a;
+}
+
+py::array_t<double> tubevector_codomains_array(const TubeVector& x)
+{
+  check_same_slicing(x);
+  return intervalvectors_array(x.codomains(), x.size());
+}
+
+py::array_t<double> tubevector_gates_array(const TubeVector& x)
+{
+  check_same_slicing(x);
+  return intervalvectors_array(x.gates(), x.size());
+}
+
 void export_TubeVector(py::module& m)
 {
   py::class_<TubeVector> tube_vector(m, "TubeVector", TUBEVECTOR_MAIN);
@@ -98,6 +200,12 @@ void export_TubeVector(py::module& m)
       TUBEVECTOR_TUBEVECTOR_STRING,
       "binary_file_name"_a)
 
+    // Used instead of .def(py::init<const vector<Interval>&,const vector<IntervalVector>&>(), from NumPy arrays:
+    // the nb_slices+1 dates t, the (nb_slices,n,2) codomains bounds and the (nb_slices+1,n,2) gates bounds
+    .def(py::init(&create_tubevector_from_arrays),
+      TUBEVECTOR_TUBEVECTOR_VECTORINTERVAL_VECTORINTERVALVECTOR,
+      "t"_a, "codomains"_a, "gates"_a=py::none())
+
     //.def(py::init<const string&,TrajectoryVector * &>(),
     //  TUBEVECTOR_TUBEVECTOR_STRING_TRAJECTORYVECTOR,
     //  "binary_file_name"_a, "traj"_a)
@@ -380,6 +488,18 @@ void export_TubeVector(py::module& m)
     .def("__iand__", [](TubeVector& s,const TubeVector& o) { return s &= o;}, 
       TUBEVECTOR_CONSTTUBEVECTOR_OPERATORINTEQ_TUBEVECTOR)
 
+  // NumPy arrays
+
+    // (nb_slices,2), (nb_slices,n,2) and (nb_slices+1,n,2) NumPy arrays of bounds
+    .def("tdomains_array", &tubevector_tdomains_array,
+      TUBEVECTOR_CONSTVECTORINTERVAL_TDOMAINS)
+
+    .def("codomains_array", &tubevector_codomains_array,
+      TUBEVECTOR_CONSTVECTORINTERVALVECTOR_CODOMAINS)
+
+    .def("gates_array", &tubevector_gates_array,
+      TUBEVECTOR_CONSTVECTORINTERVALVECTOR_GATES)
+
   // String
 
     .def("class_name", &TubeVector::class_name,
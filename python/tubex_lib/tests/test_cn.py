@@ -26,6 +26,48 @@ class TestCN(unittest.TestCase):
     self.assertEqual(cn.nb_ctc(), 1)
 
 
+  def test_CN_cancellation(self):
+
+    ctc_plus = CtcFunction(Function("a", "b", "c", "a+b-c"))
+    a = Interval(0,1)
+    b = Interval(-1,1)
+    c = Interval(1.5,2)
+
+    cn = ContractorNetwork()
+    cn.add(ctc_plus, [a, b, c])
+
+    token = CancellationToken()
+    token.cancel()
+    cn.contract(token=token)
+    self.assertEqual(a, Interval(0,1)) # stopped before any contraction
+    self.assertTrue(cn.nb_ctc_in_stack() > 0)
+
+    token.reset()
+    cn.contract(token=token)
+    self.assertEqual(a, Interval(0.5,1))
+    self.assertEqual(cn.nb_ctc_in_stack(), 0)
+
+
+  def test_CN_contract_in_threads(self):
+
+    import threading
+    v_a = [Interval(0,1) for i in range(4)]
+
+    def solve(a):
+      ctc_plus = CtcFunction(Function("a", "b", "c", "a+b-c"))
+      b, c = Interval(-1,1), Interval(1.5,2)
+      cn = ContractorNetwork()
+      cn.add(ctc_plus, [a, b, c])
+      cn.contract()
+
+    threads = [threading.Thread(target=solve, args=(a,)) for a in v_a]
+    for th in threads: th.start()
+    for th in threads: th.join()
+
+    for a in v_a:
+      self.assertEqual(a, Interval(0.5,1))
+
+
   def test_simple_static_case(self):
 
     ctc_plus = CtcFunction(Function("a", "b", "c", "a+b-c")) # algebraic constraint a+b=c
@@ -155,7 +197,7 @@ class TestCN(unittest.TestCase):
     self.assertEqual(x.codomain(), Interval(-10.,10.))
     self.assertEqual(x.nb_slices(), 4)
     self.assertEqual(v.nb_slices(), 4)
-    self.assertEqual(cn.nb_ctc(), 16)
+    self.assertEqual(cn.nb_ctc(), 13) # one contractor for the rows of slices
     self.assertEqual(cn.nb_dom(), 10)
 
     cn.set_fixedpoint_ratio(0.8)
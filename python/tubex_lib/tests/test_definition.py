@@ -1,6 +1,7 @@
 #!/usr/bin/env python
 
 import unittest
+import numpy as np
 from pyibex import Interval, IntervalVector
 from tubex_lib import *
 import tubex_lib as tubex
@@ -300,6 +301,59 @@ class TestTubeClassFunction(unittest.TestCase):
     self.assertEqual(tube_from_boxes[1].slice(3).tdomain(), Interval(12.,14.));
 
 
+class TestNumPyArrays(unittest.TestCase):
+
+  def test_Tube_arrays(self):
+
+    t = np.linspace(0.,10.,11)
+    codomains = np.column_stack((-np.arange(10.), np.arange(10.)+1.))
+    x = Tube(t, codomains)
+
+    self.assertEqual(x.nb_slices(), 10)
+    self.assertEqual(x.tdomain(), Interval(0.,10.))
+    self.assertEqual(x.slice(3).tdomain(), Interval(3.,4.))
+    self.assertEqual(x.slice(3).codomain(), Interval(-3.,4.))
+    self.assertTrue(np.array_equal(x.tdomains_array(), np.column_stack((t[:-1],t[1:]))))
+    self.assertTrue(np.array_equal(x.codomains_array(), codomains))
+
+    gates = x.gates_array()
+    self.assertEqual(gates.shape, (11,2))
+    self.assertTrue(np.array_equal(gates[3], [-2.,3.]))
+
+    gates[:,:] = [0.,1.]
+    y = Tube(t, codomains, gates)
+    self.assertEqual(y(3.), Interval(0.,1.))
+    self.assertEqual(y(3.5), Interval(-3.,4.))
+    self.assertTrue(np.array_equal(y.gates_array(), gates))
+
+  def test_TubeVector_arrays(self):
+
+    t = np.array([0.,1.,3.])
+    codomains = np.array([[[0.,1.],[2.,3.]], [[4.,5.],[6.,7.]]])
+    x = TubeVector(t, codomains)
+
+    self.assertEqual(x.size(), 2)
+    self.assertEqual(x.nb_slices(), 2)
+    self.assertEqual(x[1].slice(1).tdomain(), Interval(1.,3.))
+    self.assertEqual(x[1].slice(1).codomain(), Interval(6.,7.))
+    self.assertTrue(np.array_equal(x.codomains_array(), codomains))
+    self.assertEqual(x.gates_array().shape, (3,2,2))
+
+    # Components with different slicings
+    x[0].sample(0.5)
+    self.assertRaises(ValueError, x.codomains_array)
+    self.assertRaises(ValueError, x.gates_array)
+    self.assertRaises(ValueError, x.tdomains_array)
+
+  def test_Trajectory_arrays(self):
+
+    t = np.linspace(0.,1.,101)
+    traj = Trajectory(t, t**2)
+
+    self.assertEqual(traj.tdomain(), Interval(0.,1.))
+    self.assertAlmostEqual(traj(0.5), 0.25)
+    self.assertTrue(np.array_equal(traj.samples_array(), np.column_stack((t,t**2))))
+
 if __name__ == '__main__':
 
   unittest.main()
\ No newline at end of file
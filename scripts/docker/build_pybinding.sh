@@ -14,6 +14,7 @@ for PYBIN in /opt/python/cp3*/bin; do
   "${PYBIN}/python" -m pip install --upgrade pip
   #"${PYBIN}/python" -m pip install --upgrade pyibex
   "${PYBIN}/python" -m pip install pyibex==1.8.1
+  "${PYBIN}/python" -m pip install numpy
   mkdir -p build_dir && cd build_dir
   cmake3 -DPYTHON_EXECUTABLE=${PYBIN}/python -DCMAKE_BUILD_TYPE=Debug -DBUILD_TESTS=ON -DWITH_TUBE_TREE=OFF -DWITH_CAPD=OFF -DWITH_PYTHON=ON -DCMAKE_CXX_FLAGS="-fPIC" ..
   make api
@@ -16,6 +16,145 @@ using namespace ibex;
 
 namespace tubex
 {
+  // Reliable orientation of c with respect to the line (a,b):
+  // 1 if c is on the left, -1 if on the right, 0 if the points are possibly aligned
+  static int orientation(const Vector& a, const Vector& b, const Vector& c)
+  {
+    const Interval cross = (Interval(b[0])-a[0])*(Interval(c[1])-a[1]) - (Interval(b[1])-a[1])*(Interval(c[0])-a[0]);
+    return cross.lb() > 0. ? 1 : (cross.ub() < 0. ? -1 : 0);
+  }
+
+  // 1 if all the vertices are in counterclockwise order without aligned points, 0 otherwise
+  static bool strictly_convex(const vector<Vector>& v_pts)
+  {
+    size_t n = v_pts.size();
+    if(n < 3)
+      return false;
+
+    for(size_t i = 0 ; i < n ; i++)
+      if(orientation(v_pts[i], v_pts[(i+1)%n], v_pts[(i+2)%n]) != 1)
+        return false;
+
+    return true;
+  }
+
+  // Reliable position of pt with respect to a strictly convex polygon:
+  // 1 if inside, -1 if outside, 0 if uncertain
+  static int position(const Vector& pt, const vector<Vector>& v_pts)
+  {
+    int pos = 1;
+    for(size_t i = 0 ; i < v_pts.size() ; i++)
+    {
+      int o = orientation(v_pts[i], v_pts[(i+1)%v_pts.size()], pt);
+      if(o == -1)
+        return -1;
+      if(o == 0)
+        pos = 0;
+    }
+    return pos;
+  }
+
+  // Linear-time intersection of convex polygons (O'Rourke, Chien, Olson, Naddor, 1982):
+  // the edges of both polygons are advanced in tandem, collecting the vertices and the
+  // crossing points of the boundary of the intersection. The combinatorial decisions
+  // rely on reliable orientation tests: false is returned if one of them is uncertain
+  // (degenerate polygons, aligned points), the intersection being then not computed.
+  static bool linear_intersection(const ConvexPolygon& p1, const ConvexPolygon& p2, ConvexPolygon& inter)
+  {
+    const vector<Vector>& P = p1.vertices();
+    const vector<Vector>& Q = p2.vertices();
+
+    if(!strictly_convex(P) || !strictly_convex(Q))
+      return false;
+
+    const size_t n = P.size(), m = Q.size();
+    enum class InFlag { UNKNOWN, P_IN, Q_IN };
+    InFlag inflag = InFlag::UNKNOWN;
+    size_t a = 0, b = 0; // current edges [P[a-1],P[a]] and [Q[b-1],Q[b]]
+    size_t aa = 0, ba = 0; // numbers of advances on each polygon
+    bool first_pt = true;
+    vector<Point> v_pts;
+
+    do
+    {
+      const size_t a1 = (a+n-1) % n, b1 = (b+m-1) % m;
+
+      // Sign of the cross product of the edges directions (exactly 0 for parallel edges)
+      const Interval cross_ab = (Interval(P[a][0])-P[a1][0])*(Interval(Q[b][1])-Q[b1][1])
+                              - (Interval(P[a][1])-P[a1][1])*(Interval(Q[b][0])-Q[b1][0]);
+      if(cross_ab.contains(0.) && cross_ab != Interval(0.))
+        return false;
+      const int cross = cross_ab.lb() > 0. ? 1 : (cross_ab.ub() < 0. ? -1 : 0);
+
+      // Half-planes: heads of the edges with respect to the other edge
+      const int aHB = orientation(Q[b1], Q[b], P[a]), a1HB = orientation(Q[b1], Q[b], P[a1]);
+      const int bHA = orientation(P[a1], P[a], Q[b]), b1HA = orientation(P[a1], P[a], Q[b1]);
+      if(aHB == 0 || a1HB == 0 || bHA == 0 || b1HA == 0)
+        return false;
+
+      if(aHB != a1HB && bHA != b1HA) // proper crossing of the edges
+      {
+        if(inflag == InFlag::UNKNOWN && first_pt)
+        {
+          aa = ba = 0;
+          first_pt = false;
+        }
+
+        const Point pt = Edge(P[a1], P[a]) & Edge(Q[b1], Q[b]);
+        if(pt.does_not_exist())
+          return false;
+        v_pts.push_back(pt);
+
+        inflag = aHB > 0 ? InFlag::P_IN : InFlag::Q_IN;
+      }
+
+      else if(cross == 0 && aHB < 0 && bHA < 0) // parallel and separated edges
+      {
+        inter = ConvexPolygon();
+        return true;
+      }
+
+      // Advancing on the edge that may not cross the other one
+      if((cross >= 0 && bHA > 0) || (cross < 0 && aHB < 0))
+      {
+        if(inflag == InFlag::P_IN)
+          v_pts.push_back(Point(P[a]));
+        a = (a+1) % n; aa++;
+      }
+
+      else
+      {
+        if(inflag == InFlag::Q_IN)
+          v_pts.push_back(Point(Q[b]));
+        b = (b+1) % m; ba++;
+      }
+
+    } while((aa < n || ba < m) && aa < 2*n && ba < 2*m);
+
+    if(!first_pt) // the boundaries cross each other
+    {
+      inter = ConvexPolygon(v_pts);
+      return true;
+    }
+
+    // Otherwise, one polygon is inside the other one, or they are disjoint
+    const int p1_in_p2 = position(P[0], Q), p2_in_p1 = position(Q[0], P);
+
+    if(p1_in_p2 == 1)
+      inter = p1;
+
+    else if(p2_in_p1 == 1)
+      inter = p2;
+
+    else if(p1_in_p2 == -1 && p2_in_p1 == -1)
+      inter = ConvexPolygon();
+
+    else
+      return false;
+
+    return true;
+  }
+
   const ConvexPolygon operator+(const ConvexPolygon& x)
   {
     return x;
@@ -69,6 +208,12 @@ namespace tubex
   
   const ConvexPolygon operator&(const ConvexPolygon& p1, const ConvexPolygon& p2)
   {
+    // General case: O(n+m)
+    ConvexPolygon inter;
+    if(linear_intersection(p1, p2, inter))
+      return inter;
+
+    // Degenerate cases: O(n*m), all pairs of edges are considered
     vector<Point> v_pts;
 
     // Add all vertices of p1 that are inside p2
@@ -0,0 +1,69 @@
+/** 
+ *  Arithmetic operations on zonotopes
+ * ----------------------------------------------------------------------------
+ *  \date       2020
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2020 Simon Rohou
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#include "tubex_zonotope_arithmetic.h"
+
+using namespace std;
+using namespace ibex;
+
+namespace tubex
+{
+  const Zonotope operator+(const Zonotope& x, const Zonotope& y)
+  {
+    Zonotope z(x);
+    return z += y;
+  }
+
+  const Zonotope operator+(const Zonotope& x, const IntervalVector& v)
+  {
+    Zonotope z(x);
+    return z += v;
+  }
+
+  const Zonotope operator+(const IntervalVector& v, const Zonotope& x)
+  {
+    return x + v;
+  }
+
+  const Zonotope operator-(const Zonotope& x, const IntervalVector& v)
+  {
+    return x + (-v);
+  }
+
+  const Zonotope operator*(const IntervalMatrix& m, const Zonotope& x)
+  {
+    assert(m.nb_cols() == x.size());
+
+    Zonotope z(m.nb_rows());
+    if(x.is_empty())
+      return z;
+
+    // The thickness of the center is transformed as generators
+    Zonotope x_(x);
+    x_.expand_center();
+
+    z.m_c = m * x_.m_c;
+    for(const auto& g : x_.m_v_gen)
+      z.push_generator(m * IntervalVector(g));
+
+    return z;
+  }
+
+  const Zonotope operator&(const Zonotope& x, const IntervalVector& v)
+  {
+    Zonotope z(x);
+    return z &= v;
+  }
+
+  const Zonotope operator&(const IntervalVector& v, const Zonotope& x)
+  {
+    return x & v;
+  }
+}
@@ -0,0 +1,36 @@
+/** 
+ *  CancellationToken class
+ * ----------------------------------------------------------------------------
+ *  \date       2020
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2020 Simon Rohou
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#include "tubex_CancellationToken.h"
+
+using namespace std;
+
+namespace tubex
+{
+  CancellationToken::CancellationToken() : m_cancelled(false)
+  {
+
+  }
+
+  void CancellationToken::cancel()
+  {
+    m_cancelled.store(true, memory_order_relaxed);
+  }
+
+  void CancellationToken::reset()
+  {
+    m_cancelled.store(false, memory_order_relaxed);
+  }
+
+  bool CancellationToken::is_cancelled() const
+  {
+    return m_cancelled.load(memory_order_relaxed);
+  }
+}
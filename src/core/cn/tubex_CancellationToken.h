@@ -0,0 +1,61 @@
+/** 
+ *  \file
+ *  CancellationToken class
+ * ----------------------------------------------------------------------------
+ *  \date       2020
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2020 Simon Rohou
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#ifndef __TUBEX_CANCELLATIONTOKEN_H__
+#define __TUBEX_CANCELLATIONTOKEN_H__
+
+#include <atomic>
+
+namespace tubex
+{
+  /**
+   * \class CancellationToken
+   * \brief Flag for stopping a contraction process from another thread
+   *
+   * The token is shared between the thread running a computation and
+   * the one that may cancel it. The computation checks the token regularly
+   * and stops as soon as possible once it has been cancelled.
+   */
+  class CancellationToken
+  {
+    public:
+
+      /**
+       * \brief Creates a token, not cancelled
+       */
+      CancellationToken();
+
+      /**
+       * \brief Requests the cancellation of the computations checking this token
+       *
+       * \note This method can be called from any thread.
+       */
+      void cancel();
+
+      /**
+       * \brief Resets the token, so that it can be used for a new computation
+       */
+      void reset();
+
+      /**
+       * \brief Returns true if the cancellation has been requested
+       *
+       * \return true in case of cancellation
+       */
+      bool is_cancelled() const;
+
+    protected:
+
+      std::atomic<bool> m_cancelled; //!< cancellation flag, shared between threads
+  };
+}
+
+#endif
@@ -20,6 +20,18 @@ namespace tubex
 {
   int Contractor::ctc_counter = 0;
 
+  namespace
+  {
+    // A static contractor involving tubes is applied on each row of their slices
+    Contractor::Type static_ctc_type(const vector<Domain*>& v_domains)
+    {
+      for(const auto& dom : v_domains)
+        if(dom->type() == Domain::Type::T_TUBE)
+          return Contractor::Type::T_IBEX_ROWS;
+      return Contractor::Type::T_IBEX;
+    }
+  }
+
   Contractor::Contractor(Type type, const vector<Domain*>& v_domains)
     : m_type(type), m_v_domains(v_domains)
   {
@@ -30,7 +42,7 @@ namespace tubex
   }
 
   Contractor::Contractor(Ctc& ctc, const vector<Domain*>& v_domains)
-    : Contractor(Type::T_IBEX, v_domains)
+    : Contractor(static_ctc_type(v_domains), v_domains)
   {
     assert(!v_domains.empty());
 
@@ -53,6 +65,8 @@ namespace tubex
 
     m_name = ac.m_name;
     m_ctc_id = ac.m_ctc_id;
+    m_v_rows_values = ac.m_v_rows_values;
+    m_v_rows_tdomains = ac.m_v_rows_tdomains;
 
     switch(ac.m_type)
     {
@@ -62,6 +76,7 @@ namespace tubex
         break;
         
       case Type::T_IBEX:
+      case Type::T_IBEX_ROWS:
         m_static_ctc = reference_wrapper<Ctc>(ac.m_static_ctc);
         break;
 
@@ -91,7 +106,7 @@ namespace tubex
 
   Ctc& Contractor::ibex_ctc()
   {
-    assert(m_type == Type::T_IBEX);
+    assert(m_type == Type::T_IBEX || m_type == Type::T_IBEX_ROWS);
     return m_static_ctc.get();
   }
 
@@ -131,6 +146,7 @@ namespace tubex
     switch(m_type)
     {
       case Type::T_IBEX:
+      case Type::T_IBEX_ROWS:
         if(&m_static_ctc.get() != &x.m_static_ctc.get())
           return false;
 
@@ -318,6 +334,11 @@ namespace tubex
       }
     }
 
+    else if(m_type == Type::T_IBEX_ROWS)
+    {
+      contract_rows();
+    }
+
     else if(m_type == Type::T_TUBEX)
     {
       m_dyn_ctc.get().contract(m_v_domains);
@@ -376,6 +397,12 @@ namespace tubex
       assert(false && "unhandled case");
   }
   
+  const vector<Slice*>& Contractor::contracted_slices() const
+  {
+    assert(m_type == Type::T_IBEX_ROWS);
+    return m_v_contracted_slices;
+  }
+
   const string Contractor::name() const
   {
     switch(type())
@@ -398,6 +425,7 @@ namespace tubex
         return "\\mathcal{C}_{" + m_name + "}";
 
       case Type::T_IBEX:
+      case Type::T_IBEX_ROWS:
       default:
         return "\\mathcal{C}_{" + m_name + "}";
     }
@@ -408,6 +436,143 @@ namespace tubex
     m_name = name;
   }
   
+  void Contractor::contract_rows()
+  {
+    assert(m_type == Type::T_IBEX_ROWS);
+
+    Ctc& ctc = m_static_ctc.get();
+    const int n = ctc.nb_var;
+    assert((int)m_v_domains.size() == n);
+
+    m_v_contracted_slices.clear();
+
+    // Slices of the current row: the slices of the tubes are iterated, while
+    // the other domains (intervals, single slices) are the same for all rows
+    vector<Slice*> v_slices(n, NULL);
+    vector<bool> v_iterated(n, false);
+    int i_ref = -1; // a tube defining the rows
+    for(int i = 0 ; i < n ; i++)
+      switch(m_v_domains[i]->type())
+      {
+        case Domain::Type::T_INTERVAL:
+          break;
+
+        case Domain::Type::T_SLICE:
+          v_slices[i] = &m_v_domains[i]->slice();
+          break;
+
+        case Domain::Type::T_TUBE:
+          v_slices[i] = m_v_domains[i]->tube().first_slice();
+          v_iterated[i] = true;
+          i_ref = i;
+          break;
+
+        default:
+          assert(false && "unhandled case");
+      }
+
+    assert(i_ref != -1);
+
+    // The rows are aligned by tdomain: the slicings of the tubes may have changed
+    // since this contractor was added, so a row is the intersection of the tdomains
+    // of the current slices. An envelope or a gate of a slice that does not match
+    // the row is only used as an enclosure, and is not contracted.
+    Interval row_tdomain;
+
+    // j: 0 for the envelope, 1 and 2 for the input and output gates
+    auto matches_row = [&](int i, int j) -> bool
+    {
+      if(!v_iterated[i])
+        return true;
+      const Interval& tdomain = v_slices[i]->tdomain();
+      return j == 0 ? tdomain == row_tdomain
+        : (j == 1 ? tdomain.lb() == row_tdomain.lb() : tdomain.ub() == row_tdomain.ub());
+    };
+
+    auto row_value = [&](int i, int j) -> Interval
+    {
+      if(v_slices[i] == NULL)
+        return m_v_domains[i]->interval();
+      if(j == 0 || !matches_row(i,j))
+        return v_slices[i]->codomain();
+      return j == 1 ? v_slices[i]->input_gate() : v_slices[i]->output_gate();
+    };
+
+    IntervalVector box(n);
+    size_t row = 0;
+
+    while(v_slices[i_ref] != NULL)
+    {
+      row_tdomain = v_slices[i_ref]->tdomain();
+      for(int i = 0 ; i < n ; i++)
+        if(v_iterated[i])
+          row_tdomain &= v_slices[i]->tdomain();
+      assert(!row_tdomain.is_empty() && "tubes should share the same tdomain");
+
+      if(m_v_rows_tdomains.size() <= row)
+      {
+        m_v_rows_values.resize(3*n*(row+1), Interval::EMPTY_SET);
+        m_v_rows_tdomains.resize(row+1, Interval::EMPTY_SET);
+      }
+      Interval *row_values = &m_v_rows_values[3*n*row];
+
+      // The row is contracted only if it has been updated since its last contraction
+
+      bool updated_row = row_tdomain != m_v_rows_tdomains[row];
+      for(int j = 0 ; j < 3 && !updated_row ; j++)
+        for(int i = 0 ; i < n && !updated_row ; i++)
+          updated_row = row_value(i,j) != row_values[j*n+i];
+
+      if(updated_row)
+      {
+        for(int j = 0 ; j < 3 ; j++) // envelopes, then gates
+        {
+          for(int i = 0 ; i < n ; i++)
+            box[i] = row_value(i,j);
+
+          ctc.contract(box);
+
+          for(int i = 0 ; i < n ; i++)
+          {
+            if(v_slices[i] == NULL)
+              m_v_domains[i]->interval() = box[i];
+
+            else if(matches_row(i,j) && box[i] != row_value(i,j))
+            {
+              if(j == 0)
+                v_slices[i]->set_envelope(box[i]);
+              else if(j == 1)
+                v_slices[i]->set_input_gate(box[i]);
+              else
+                v_slices[i]->set_output_gate(box[i]);
+
+              // Gates are shared with the neighbouring slices
+              if(v_iterated[i])
+              {
+                m_v_contracted_slices.push_back(v_slices[i]);
+                if(j == 1 && v_slices[i]->prev_slice() != NULL)
+                  m_v_contracted_slices.push_back(v_slices[i]->prev_slice());
+                else if(j == 2 && v_slices[i]->next_slice() != NULL)
+                  m_v_contracted_slices.push_back(v_slices[i]->next_slice());
+              }
+            }
+          }
+        }
+
+        for(int j = 0 ; j < 3 ; j++)
+          for(int i = 0 ; i < n ; i++)
+            row_values[j*n+i] = row_value(i,j);
+        m_v_rows_tdomains[row] = row_tdomain;
+      }
+
+      // Next row: the slices ending with this one are iterated
+      row++;
+      for(int i = 0 ; i < n ; i++)
+        if(v_iterated[i] && v_slices[i]->tdomain().ub() == row_tdomain.ub())
+          v_slices[i] = v_slices[i]->next_slice();
+    }
+  }
+  
   ostream& operator<<(ostream& str, const Contractor& x)
   {
     str << "Contractor " << x.name() << " (" << x.m_v_domains.size() << " doms)" << flush;
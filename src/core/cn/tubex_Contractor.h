@@ -34,7 +34,8 @@ namespace tubex
   {
     public:
 
-      enum class Type { T_COMPONENT, T_EQUALITY, T_IBEX, T_TUBEX };
+      // T_IBEX_ROWS: static contractor applied on each row of slices of tubes
+      enum class Type { T_COMPONENT, T_EQUALITY, T_IBEX, T_IBEX_ROWS, T_TUBEX };
 
       Contractor(Type type, const std::vector<Domain*>& v_domains);
       Contractor(ibex::Ctc& ctc, const std::vector<Domain*>& v_domains);
@@ -58,6 +59,9 @@ namespace tubex
 
       void contract();
 
+      // T_IBEX_ROWS: slices contracted by the last call to contract()
+      const std::vector<Slice*>& contracted_slices() const;
+
       const std::string name() const;
       void set_name(const std::string& name);
 
@@ -66,6 +70,8 @@ namespace tubex
 
     protected:
 
+      void contract_rows();
+
       const Type m_type;
       double m_active = true;
 
@@ -77,6 +83,13 @@ namespace tubex
 
       std::vector<Domain*> m_v_domains;
 
+      // T_IBEX_ROWS: values of each row of slices after its last contraction
+      // (envelopes, input gates, output gates) and its tdomain, for contracting
+      // only updated rows
+      std::vector<ibex::Interval> m_v_rows_values;
+      std::vector<ibex::Interval> m_v_rows_tdomains;
+      std::vector<Slice*> m_v_contracted_slices;
+
       std::string m_name;
       int m_ctc_id;
 
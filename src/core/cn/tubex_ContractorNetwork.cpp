@@ -156,84 +156,82 @@ namespace tubex
       assert((n % static_ctc.nb_var == 0) && "invalid total dimension of domains");
 
       // Adding domains to the CN
+      vector<Domain*> v_doms;
       for(auto& dom : v_domains)
-        add_dom(dom);
+        v_doms.push_back(add_dom(dom));
 
       for(int i = 0 ; i < n/static_ctc.nb_var ; i++) // in case we are dealing with array data
       {
-        int k = 0; // k-th slice
-        int slices_nb = -1; // will be determined during the dowhile loop, if one dyn domain is present
-
-        do
+        // Creating a vector of pointers to domains. Tubes are not broken down into slices:
+        // the contractor will be applied on each row of slices (see Contractor::contract_rows())
+        vector<Domain*> v_dom_ptr;
+        for(size_t d = 0 ; d < v_domains.size() ; d++)
         {
-          // Creating a vector of pointers to domains
-          vector<Domain*> v_dom_ptr;
-          for(auto& dom : v_domains)
+          const Domain& dom = v_domains[d];
+
+          switch(dom.type())
           {
-            switch(dom.type())
-            {
-              case Domain::Type::T_INTERVAL:
-                assert(n/static_ctc.nb_var == 1); // no array configuration with scalar type
-              case Domain::Type::T_SLICE:
-                v_dom_ptr.push_back(add_dom(dom));
-                break;
-
-              case Domain::Type::T_INTERVAL_VECTOR:
-                if(n/static_ctc.nb_var == 1) // heterogeneous case
-                {
-                  // todo: ? add the vector itself, or each component as it is now:
-                  for(int j = 0 ; j < dom.interval_vector().size() ; j++)
-                    v_dom_ptr.push_back(add_dom(Domain::vector_component(const_cast<Domain&>(dom), j)));
-                }
-
-                else // array data case
-                {
-                  assert((dom.interval_vector().size() == n/static_ctc.nb_var) && "wrong vector dimension");
-                  v_dom_ptr.push_back(add_dom(Domain::vector_component(const_cast<Domain&>(dom), i)));
-                }
-                break;
-
-              case Domain::Type::T_TUBE:
-                assert(n/static_ctc.nb_var == 1); // no array configuration with scalar type
-                v_dom_ptr.push_back(add_dom(Domain(const_cast<Slice&>(*dom.tube().slice(k)))));
-                slices_nb = dom.tube().nb_slices();
-                break;
-
-              case Domain::Type::T_TUBE_VECTOR:
-                if(n/static_ctc.nb_var == 1) // heterogeneous case
-                {
-                  for(int j = 0 ; j < dom.tube_vector().size() ; j++)
-                    v_dom_ptr.push_back(add_dom(Domain(const_cast<Slice&>(*dom.tube_vector()[j].slice(k)))));
-                }
-
-                else // array data case
-                {
-                  assert((dom.tube_vector().size() == n/static_ctc.nb_var) && "wrong vector dimension");
-                  v_dom_ptr.push_back(add_dom(Domain(const_cast<Slice&>(*dom.tube_vector()[i].slice(k)))));
-                }
-
-                slices_nb = dom.tube_vector().nb_slices();
-                break;
-
-              default:
-                assert(false && "unhandled case");
-            }
+            case Domain::Type::T_INTERVAL:
+            case Domain::Type::T_TUBE:
+              assert(n/static_ctc.nb_var == 1); // no array configuration with scalar type
+            case Domain::Type::T_SLICE:
+              v_dom_ptr.push_back(v_doms[d]);
+              break;
+
+            case Domain::Type::T_INTERVAL_VECTOR:
+              if(n/static_ctc.nb_var == 1) // heterogeneous case
+              {
+                // todo: ? add the vector itself, or each component as it is now:
+                for(int j = 0 ; j < dom.interval_vector().size() ; j++)
+                  v_dom_ptr.push_back(add_dom(Domain::vector_component(const_cast<Domain&>(dom), j)));
+              }
+
+              else // array data case
+              {
+                assert((dom.interval_vector().size() == n/static_ctc.nb_var) && "wrong vector dimension");
+                v_dom_ptr.push_back(add_dom(Domain::vector_component(const_cast<Domain&>(dom), i)));
+              }
+              break;
+
+            case Domain::Type::T_TUBE_VECTOR:
+              if(n/static_ctc.nb_var == 1) // heterogeneous case
+              {
+                for(int j = 0 ; j < dom.tube_vector().size() ; j++)
+                  v_dom_ptr.push_back(add_dom(Domain(v_doms[d]->tube_vector()[j])));
+              }
+
+              else // array data case
+              {
+                assert((dom.tube_vector().size() == n/static_ctc.nb_var) && "wrong vector dimension");
+                v_dom_ptr.push_back(add_dom(Domain(v_doms[d]->tube_vector()[i])));
+              }
+              break;
+
+            default:
+              assert(false && "unhandled case");
           }
+        }
+
+        assert((int)v_dom_ptr.size() == static_ctc.nb_var);
 
-          assert((int)v_dom_ptr.size() == static_ctc.nb_var);
+        // Creating what would be this new contractor (defined with domains)
+        Contractor ctc(static_ctc, v_dom_ptr);
 
-          // Creating what would be this new contractor (defined with domains)
-          Contractor ctc(static_ctc, v_dom_ptr);
+        // Getting the actual contractor (maybe the same if not already added)
+        size_t nb_ctc_before = m_v_ctc.size();
+        Contractor *ctc_ptr = add_ctc(ctc);
 
-          // Getting the actual contractor (maybe the same if not already added)
-          Contractor *ctc_ptr = add_ctc(ctc);
+        // Linking to the related domains
+        for(auto& dom : v_dom_ptr)
+          dom->add_ctc(ctc_ptr);
 
-          // Linking to the related domains
+        // A contractor on rows of slices is also linked to the slices of its tubes,
+        // so that it is triggered by local contractions
+        if(ctc_ptr->type() == Contractor::Type::T_IBEX_ROWS && m_v_ctc.size() != nb_ctc_before)
           for(auto& dom : v_dom_ptr)
-            dom->add_ctc(ctc_ptr);
-
-          k++;
-        } while(k < slices_nb);
+            if(dom->type() == Domain::Type::T_TUBE)
+              for(Slice *s = dom->tube().first_slice() ; s != NULL ; s = s->next_slice())
+                add_dom(Domain(*s))->add_ctc(ctc_ptr);
       }
     }
 
@@ -375,19 +373,56 @@ namespace tubex
 
   // Protected methods
 
+    Domain* ContractorNetwork::find_dom(const Domain& ad) const
+    {
+      // The candidates share the address of its values or of its memory object
+      const void *addr[2];
+      ad.memory_addresses(addr[0], addr[1]);
+
+      size_t found_id = m_v_domains.size();
+      for(int k = 0 ; k < 2 ; k++)
+      {
+        auto range = m_map_domains.equal_range(addr[k]);
+        for(auto it = range.first ; it != range.second ; it++)
+          if(it->second < found_id && *m_v_domains[it->second] == ad)
+            found_id = it->second; // the first added one is kept
+      }
+
+      return found_id != m_v_domains.size() ? m_v_domains[found_id] : NULL;
+    }
+
+    Domain* ContractorNetwork::find_dom(const Slice& s) const
+    {
+      auto range = m_map_domains.equal_range(&s);
+      for(auto it = range.first ; it != range.second ; it++)
+      {
+        Domain *dom = m_v_domains[it->second];
+        if(dom->type() == Domain::Type::T_SLICE && &dom->slice() == &s)
+          return dom;
+      }
+
+      return NULL;
+    }
+
     Domain* ContractorNetwork::add_dom(const Domain& ad)
     {
       assert(!ad.is_empty() && "domain already empty when added to the CN");
 
       // Looking if this domain is not already part of the graph
-      for(auto& dom : m_v_domains)
-        if(*dom == ad) // found
-          return dom;
+      Domain *found_dom = find_dom(ad);
+      if(found_dom != NULL)
+        return found_dom;
       
       // Else, create and add this new domain
         Domain *dom = new Domain(ad);
         m_v_domains.push_back(dom);
 
+        const void *addr[2];
+        dom->memory_addresses(addr[0], addr[1]);
+        m_map_domains.emplace(addr[0], m_v_domains.size()-1);
+        if(addr[1] != addr[0])
+          m_map_domains.emplace(addr[1], m_v_domains.size()-1);
+
       // And add possible dependencies
 
         switch(dom->type())
@@ -464,8 +499,15 @@ namespace tubex
 
     Contractor* ContractorNetwork::add_ctc(const Contractor& ac)
     {
-      // Looking if this contractor is not already part of the graph
-      for(auto& ctc : m_v_ctc)
+      // Looking if this contractor is not already part of the graph: an equal
+      // contractor is linked to each domain of ac, so only the contractors
+      // of its least connected domain are compared
+      const Domain *dom = ac.domains()[0];
+      for(const auto& dom_i : ac.domains())
+        if(dom_i->contractors().size() < dom->contractors().size())
+          dom = dom_i;
+
+      for(auto& ctc : dom->contractors())
         if(*ctc == ac) // found
           return ctc;
 
@@ -13,12 +13,14 @@
 #define __TUBEX_CONTRACTORNETWORK_H__
 
 #include <deque>
+#include <unordered_map>
 #include <initializer_list>
 #include "ibex_Ctc.h"
 #include "tubex_DynCtc.h"
 #include "tubex_Domain.h"
 #include "tubex_Contractor.h"
 #include "tubex_CtcDeriv.h"
+#include "tubex_CancellationToken.h"
 
 namespace ibex
 {
@@ -171,7 +173,9 @@ namespace tubex
        * \brief Adds to the graph a static contractor (inherited from Ctc class) with related Domains
        *
        * \note If tubes are involved in the domain list, they must share the same slicing and tdomain.
-       *       The static contractor will be applied on each slice of these tubes.
+       *       The static contractor will be applied on each slice of these tubes. It is represented
+       *       by a single contractor in the graph, that only contracts the rows of slices
+       *       updated since their last contraction.
        *
        * \param static_ctc ibex::Ctc contractor object
        * \param v_domains a vector of abstract domains (Interval, Slice, Tube, etc.)
@@ -242,12 +246,23 @@ namespace tubex
        *
        * Note that the computation time may slightly exceed \f$dt\f$.
        *
-       * \param dt allowed computation time
+       * \param dt allowed computation time (elapsed real time, not CPU time)
        * \param verbose verbose mode, `false` by default
        * \return the computation time in seconds
        */
       double contract_during(double dt, bool verbose = false);
 
+      /**
+       * \brief Sets a token for stopping the contraction process from another thread
+       *
+       * The token is checked between two contractions. Once it has been cancelled,
+       * the contraction process stops and the remaining contractors stay in the stack:
+       * a next call to contract() resumes the propagation.
+       *
+       * \param token pointer to the token, or `NULL` for removing it
+       */
+      void set_cancellation_token(const CancellationToken *token);
+
       /**
        * \brief Sets the fixed point ratio defining the end of the propagation process.
        *
@@ -337,6 +352,25 @@ namespace tubex
 
     protected:
 
+      /**
+       * \brief Looks for an equal abstract Domain in the graph
+       *
+       * \param ad abstract Domain object
+       * \return the pointer to the related Domain object in the graph, NULL if not found
+       */
+      Domain* find_dom(const Domain& ad) const;
+
+      /**
+       * \brief Looks for the Domain of a Slice in the graph
+       *
+       * \note Unlike find_dom(const Domain&), no Domain object is built,
+       *       so the slice is not modified.
+       *
+       * \param s Slice object
+       * \return the pointer to the related Domain object in the graph, NULL if not found
+       */
+      Domain* find_dom(const Slice& s) const;
+
       /**
        * \brief Adds an abstract Domain to the graph
        *
@@ -381,10 +415,12 @@ namespace tubex
 
       std::vector<Contractor*> m_v_ctc; //!< vector of pointers to the abstract Contractor objects the graph is made of
       std::vector<Domain*> m_v_domains; //!< vector of pointers to the abstract Domain objects the graph is made of
+      std::unordered_multimap<const void*,size_t> m_map_domains; //!< indexes of the domains in m_v_domains, by memory addresses
       std::deque<Contractor*> m_deque; //!< queue of active contractors
 
       float m_fixedpoint_ratio = 0.0001; //!< fixed point ratio for propagation limit
       double m_contraction_duration_max = std::numeric_limits<double>::infinity(); //!< computation time limit
+      const CancellationToken *m_cancellation_token = NULL; //!< optional token for stopping the contraction process
 
       CtcDeriv *m_ctc_deriv = NULL; //!< optional pointer to a CtcDeriv object that can be automatically added in the graph
       std::list<std::pair<Domain*,Domain*> > m_domains_related_to_ctcderiv;
@@ -8,7 +8,7 @@
  *              the GNU Lesser General Public License (LGPL).
  */
 
-#include <time.h>
+#include <chrono>
 #include "tubex_ContractorNetwork.h"
 
 using namespace std;
@@ -22,7 +22,12 @@ namespace tubex
 
     double ContractorNetwork::contract(bool verbose)
     {
-      clock_t t_start = clock();
+      // Wall-clock time: the CPU time of the process would also count
+      // the computations of other threads (contractions in parallel)
+      const auto t_start = chrono::steady_clock::now();
+      auto elapsed_time = [&t_start]() {
+        return chrono::duration<double>(chrono::steady_clock::now() - t_start).count();
+      };
 
       if(verbose)
       {
@@ -35,7 +40,8 @@ namespace tubex
       }
 
       while(!m_deque.empty()
-        && (double)(clock() - t_start)/CLOCKS_PER_SEC < m_contraction_duration_max)
+        && elapsed_time() < m_contraction_duration_max
+        && (m_cancellation_token == NULL || !m_cancellation_token->is_cancelled()))
       {
         Contractor *ctc = m_deque.front();
         m_deque.pop_front();
@@ -43,16 +49,35 @@ namespace tubex
         ctc->contract();
         ctc->set_active(false);
 
-        for(auto& ctc_dom : ctc->domains()) // for each domain related to this contractor
+        if(ctc->type() == Contractor::Type::T_IBEX_ROWS)
         {
-          // If the domain has "changed" after the contraction
-          trigger_ctc_related_to_dom(ctc_dom, ctc);
+          // Only the slices of the contracted rows are considered, so that the
+          // propagation keeps the slice granularity. This contractor may be
+          // triggered again by its own contractions (gates shared by consecutive
+          // rows, scalar variables)
+          for(const auto& s : ctc->contracted_slices())
+          {
+            Domain *slice_dom = find_dom(*s);
+            if(slice_dom != NULL)
+              trigger_ctc_related_to_dom(slice_dom);
+          }
+
+          for(auto& ctc_dom : ctc->domains())
+            if(ctc_dom->type() != Domain::Type::T_TUBE) // tubes: see the contracted slices above
+              trigger_ctc_related_to_dom(ctc_dom);
         }
+
+        else
+          for(auto& ctc_dom : ctc->domains()) // for each domain related to this contractor
+          {
+            // If the domain has "changed" after the contraction
+            trigger_ctc_related_to_dom(ctc_dom, ctc);
+          }
       }
 
       if(verbose)
         cout << endl
-             << "  computation time: " << (double)(clock() - t_start)/CLOCKS_PER_SEC << "s" << endl;
+             << "  computation time: " << elapsed_time() << "s" << endl;
 
       // Emptiness test
       // todo: test only contracted domains?
@@ -64,7 +89,7 @@ namespace tubex
             break;
           }
 
-      return (double)(clock() - t_start)/CLOCKS_PER_SEC;
+      return elapsed_time();
     }
 
     double ContractorNetwork::contract_during(double dt, bool verbose)
@@ -76,6 +101,11 @@ namespace tubex
       return contraction_time;
     }
 
+    void ContractorNetwork::set_cancellation_token(const CancellationToken *token)
+    {
+      m_cancellation_token = token;
+    }
+
     void ContractorNetwork::set_fixedpoint_ratio(float r)
     {
       assert(Interval(0.,1).contains(r) && "invalid ratio");
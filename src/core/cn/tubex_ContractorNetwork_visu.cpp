@@ -35,7 +35,8 @@ namespace tubex
       #endif
 
       for(const auto& added_ctc: m_v_ctc)
-        if(added_ctc->type() == Contractor::Type::T_IBEX && &added_ctc->ibex_ctc() == &ctc)
+        if((added_ctc->type() == Contractor::Type::T_IBEX || added_ctc->type() == Contractor::Type::T_IBEX_ROWS)
+          && &added_ctc->ibex_ctc() == &ctc)
         {
           added_ctc->set_name(name);
           #ifndef NDEBUG
@@ -92,7 +93,10 @@ namespace tubex
       dot_file << endl << "  // Relations" << endl;
       for(const auto ctc : m_v_ctc)
         for(const auto dom : m_v_domains)
-          if(find(dom->contractors().begin(), dom->contractors().end(), ctc) != dom->contractors().end())
+          if(find(dom->contractors().begin(), dom->contractors().end(), ctc) != dom->contractors().end()
+            // the links of a contractor on rows to the slices of its tubes are not displayed
+            && !(ctc->type() == Contractor::Type::T_IBEX_ROWS && dom->type() == Domain::Type::T_SLICE
+              && find(ctc->domains().begin(), ctc->domains().end(), dom) == ctc->domains().end()))
             dot_file << "  " << Tools::add_int("ctc",ctc->id()) << " -- " << Tools::add_int("dom",dom->id()) << ";" << endl;
 
       // Subgraph for clustering components of a same vector
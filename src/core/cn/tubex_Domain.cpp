@@ -19,6 +19,38 @@ namespace tubex
 {
   int Domain::dom_counter = 0;
 
+  namespace
+  {
+    // Diameter used for the fixed point detection: an unbounded interval counts
+    // for a large value, so that ratios of volumes remain defined
+    // todo: manager the unbounded case for fixed point detection
+    double bounded_diam(const Interval& x)
+    {
+      if(x.is_empty())
+        return 0.;
+
+      else if(x.is_unbounded())
+        return 999999.;
+
+      else
+        return x.diam();
+    }
+
+    // Envelope and output gate of a slice (the input gate is the output one of the previous slice)
+    double slice_volume(const Slice& s)
+    {
+      return s.tdomain().diam() * bounded_diam(s.codomain()) + bounded_diam(s.output_gate());
+    }
+
+    double tube_volume(const Tube& x)
+    {
+      double vol = bounded_diam(x.first_slice()->input_gate());
+      for(const Slice *s = x.first_slice() ; s != NULL ; s = s->next_slice())
+        vol += slice_volume(*s);
+      return vol;
+    }
+  }
+
   Domain::Domain()
     : m_type(Type::T_INTERVAL), m_memory_type(MemoryRef::M_DOUBLE)
   {
@@ -403,63 +435,22 @@ namespace tubex
     switch(m_type)
     {
       case Type::T_INTERVAL:
-        if(interval().is_empty())
-          return 0.;
-        
-        else if(interval().is_unbounded())
-          return 999999.; // todo: manager the unbounded case for fixed point detection
-        
-        else
-          return interval().diam();
+        return bounded_diam(interval());
 
       case Type::T_INTERVAL_VECTOR:
         return interval_vector().volume();
 
       case Type::T_SLICE:
-      {
-        double vol = slice().volume();
-
-        // todo: clean the following:
-
-        if(slice().input_gate().is_empty())
-          vol += 0.;
-        else if(slice().input_gate().is_unbounded())
-          vol += 999999.; // todo: manager the unbounded case for fixed point detection
-        else
-          vol += slice().input_gate().diam();
-
-        if(slice().output_gate().is_empty())
-          vol += 0.;
-        else if(slice().output_gate().is_unbounded())
-          vol += 999999.; // todo: manager the unbounded case for fixed point detection
-        else
-          vol += slice().output_gate().diam();
-
-        return vol;
-      }
+        return bounded_diam(slice().input_gate()) + slice_volume(slice());
 
       case Type::T_TUBE:
-      {
-        double vol = tube().volume();
-        vol += tube().first_slice()->input_gate().diam();
-        for(const Slice *s = tube().first_slice() ; s != NULL ; s = s->next_slice())
-          vol += s->output_gate().diam();
-        return vol;
-      }
+        return tube_volume(tube());
 
       case Type::T_TUBE_VECTOR:
       {
-        // todo: improve this
         double vol = 0.;
-
         for(int i = 0 ; i < tube_vector().size() ; i++)
-        {
-          vol += tube_vector()[i].volume();
-          vol += tube_vector()[i].first_slice()->input_gate().diam();
-          for(const Slice *s = tube_vector()[i].first_slice() ; s != NULL ; s = s->next_slice())
-            vol += s->output_gate().diam();
-        }
-        
+          vol += tube_volume(tube_vector()[i]);
         return vol;
       }
 
@@ -618,6 +609,69 @@ namespace tubex
     }
   }
   
+  void Domain::memory_addresses(const void*& values_addr, const void*& memory_addr) const
+  {
+    switch(m_type)
+    {
+      case Type::T_INTERVAL:
+        values_addr = &m_ref_values_i.get();
+        break;
+
+      case Type::T_INTERVAL_VECTOR:
+        values_addr = &m_ref_values_iv.get();
+        break;
+
+      case Type::T_SLICE:
+        values_addr = &m_ref_values_s.get();
+        break;
+
+      case Type::T_TUBE:
+        values_addr = &m_ref_values_t.get();
+        break;
+
+      case Type::T_TUBE_VECTOR:
+        values_addr = &m_ref_values_tv.get();
+        break;
+
+      default:
+        assert(false && "unhandled case");
+    }
+
+    switch(m_memory_type)
+    {
+      case MemoryRef::M_DOUBLE:
+        memory_addr = &m_ref_memory_d.get();
+        break;
+
+      case MemoryRef::M_INTERVAL:
+        memory_addr = &m_ref_memory_i.get();
+        break;
+
+      case MemoryRef::M_VECTOR:
+        memory_addr = &m_ref_memory_v.get();
+        break;
+
+      case MemoryRef::M_INTERVAL_VECTOR:
+        memory_addr = &m_ref_memory_iv.get();
+        break;
+
+      case MemoryRef::M_SLICE:
+        memory_addr = &m_ref_memory_s.get();
+        break;
+
+      case MemoryRef::M_TUBE:
+        memory_addr = &m_ref_memory_t.get();
+        break;
+
+      case MemoryRef::M_TUBE_VECTOR:
+        memory_addr = &m_ref_memory_tv.get();
+        break;
+
+      default:
+        assert(false && "unhandled case");
+    }
+  }
+
   bool Domain::operator!=(const Domain& x) const
   {
     return !operator==(x);
@@ -110,6 +110,10 @@ namespace tubex
       Domain(Type type, MemoryRef memory_type);
       const std::string var_name(const std::vector<Domain*>& v_domains) const;
 
+      // Addresses of the values and of the memory object of this domain:
+      // two equal domains share at least one of these addresses
+      void memory_addresses(const void*& values_addr, const void*& memory_addr) const;
+
       // Theoretical type of domain
 
         Type m_type;
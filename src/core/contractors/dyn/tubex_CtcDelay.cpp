@@ -47,14 +47,21 @@ namespace tubex
         return;
     }
 
+    // Along the sweep, the lower bounds of the evaluation times [t]+[a]
+    // (resp. [t]-[a]) never decrease, because [a] can only be contracted.
+    // The slices of the other tube are then reached from the previous ones.
+
     // iterate over the first tube x
+    const Interval y_tdomain = y.tdomain();
+    const Slice *sweep_y = y.first_slice();
     Slice *s_x = x.first_slice();
     while(s_x != NULL)
     {
       const Interval t_x = s_x->tdomain();
       Interval intv_t = t_x + a;
-      if(intv_t.is_subset(y.tdomain())){
-          const Interval t_y = y.invert(s_x->codomain(),intv_t);
+      if(intv_t.is_subset(y_tdomain)){
+          sweep_y = sweep_to(sweep_y, intv_t.lb());
+          const Interval t_y = sweep_invert(sweep_y, s_x->codomain(), intv_t);
           a &= t_y - t_x;
 
           if(a.is_empty()){
@@ -64,16 +71,19 @@ namespace tubex
           }
 
           intv_t = t_x + a;
-          s_x->set_envelope(s_x->codomain() & y(intv_t));
+          sweep_y = sweep_to(sweep_y, intv_t.lb());
+          s_x->set_envelope(s_x->codomain() & sweep_eval(sweep_y, intv_t));
       }
 
       intv_t = t_x.lb() + a;
-      if(intv_t.is_subset(y.tdomain()))
-          s_x->set_input_gate(s_x->input_gate() & y(intv_t));
+      if(intv_t.is_subset(y_tdomain)){
+          sweep_y = sweep_to(sweep_y, intv_t.lb());
+          s_x->set_input_gate(s_x->input_gate() & sweep_eval(sweep_y, intv_t));
+      }
 
       intv_t = t_x.ub() + a;
-      if(intv_t.is_subset(y.tdomain()))
-          s_x->set_output_gate(s_x->output_gate() & y(intv_t));
+      if(intv_t.is_subset(y_tdomain))
+          s_x->set_output_gate(s_x->output_gate() & sweep_eval(sweep_to(sweep_y, intv_t.lb()), intv_t));
 
       if(s_x->is_empty()){
           a.set_empty();
@@ -86,13 +96,16 @@ namespace tubex
     }
 
     // iterate over the second tube y
+    const Interval x_tdomain = x.tdomain();
+    const Slice *sweep_x = x.first_slice();
     Slice *s_y = y.first_slice();
     while(s_y != NULL)
     {
       const Interval t_y = s_y->tdomain();
       Interval intv_t = t_y - a;
-      if(intv_t.is_subset(x.tdomain())){
-          const Interval t_x = x.invert(s_y->codomain(),intv_t);
+      if(intv_t.is_subset(x_tdomain)){
+          sweep_x = sweep_to(sweep_x, intv_t.lb());
+          const Interval t_x = sweep_invert(sweep_x, s_y->codomain(), intv_t);
           a &= t_y - t_x;
 
           if(a.is_empty()){
@@ -102,16 +115,19 @@ namespace tubex
           }
 
           intv_t = t_y - a;
-          s_y->set_envelope(s_y->codomain() & x(intv_t));
+          sweep_x = sweep_to(sweep_x, intv_t.lb());
+          s_y->set_envelope(s_y->codomain() & sweep_eval(sweep_x, intv_t));
       }
 
       intv_t = t_y.lb() - a;
-      if(intv_t.is_subset(x.tdomain()))
-          s_y->set_input_gate(s_y->input_gate() & x(intv_t));
+      if(intv_t.is_subset(x_tdomain)){
+          sweep_x = sweep_to(sweep_x, intv_t.lb());
+          s_y->set_input_gate(s_y->input_gate() & sweep_eval(sweep_x, intv_t));
+      }
 
       intv_t = t_y.ub() - a;
-      if(intv_t.is_subset(x.tdomain()))
-          s_y->set_output_gate(s_y->output_gate() & x(intv_t));
+      if(intv_t.is_subset(x_tdomain))
+          s_y->set_output_gate(s_y->output_gate() & sweep_eval(sweep_to(sweep_x, intv_t.lb()), intv_t));
 
       if(s_y->is_empty()){
           a.set_empty();
@@ -150,4 +166,44 @@ namespace tubex
         y.set_empty();
     }
   }
+
+  const Slice* CtcDelay::sweep_to(const Slice *s, double t)
+  {
+    assert(s != NULL);
+    assert(s->tdomain().lb() <= t && "sweeping backward in time");
+
+    while(s->next_slice() != NULL && t >= s->tdomain().ub())
+      s = s->next_slice();
+    return s;
+  }
+
+  const Interval CtcDelay::sweep_eval(const Slice *s, const Interval& t)
+  {
+    assert(s != NULL);
+
+    if(t.is_empty())
+      return Interval::EMPTY_SET;
+
+    if(t.is_degenerated())
+      return (*s)(t.lb());
+
+    Interval codomain = Interval::EMPTY_SET;
+    for( ; s != NULL && s->tdomain().lb() < t.ub() ; s = s->next_slice())
+      codomain |= s->codomain();
+    return codomain;
+  }
+
+  const Interval CtcDelay::sweep_invert(const Slice *s, const Interval& z, const Interval& t)
+  {
+    assert(s != NULL);
+    assert(!t.is_degenerated());
+
+    // Without derivative information, a slice is a box:
+    // its inversion is either empty or its whole intersection with [t]
+    Interval invert = Interval::EMPTY_SET;
+    for( ; s != NULL && s->tdomain().lb() < t.ub() ; s = s->next_slice())
+      if(s->codomain().intersects(z))
+        invert |= t & s->tdomain();
+    return invert;
+  }
 }
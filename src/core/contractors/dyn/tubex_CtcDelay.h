@@ -45,6 +45,11 @@ namespace tubex
        *        contracts the tubes \f$[x](\cdot)\f$, \f$[y](\cdot)\f$ and the delay \f$[a]\f$
        *        with respect to the constraint \f$x(t)=y(t+a)\f$
        *
+       * \note The two tubes are swept in lockstep: the slices of \f$[y](\cdot)\f$ involved
+       *       at \f$[t]+[a]\f$ are reached from the ones of the previous slice of \f$[x](\cdot)\f$.
+       *       The complexity is then linear in the number of slices when \f$[a]\f$
+       *       is thin with respect to the slices width.
+       *
        * \param a the delay value \f$\tau\f$ to be contracted
        * \param x the scalar tube \f$[x](\cdot)\f$ to be contracted
        * \param y the scalar tube \f$[y](\cdot)\f$ to be contracted
@@ -64,6 +69,40 @@ namespace tubex
 
     protected:
 
+      /**
+       * \brief Moves forward a slice pointer up to the slice defined at \f$t\f$
+       *
+       * \note Same convention as Tube::slice(double): if two slices are
+       *       defined at \f$t\f$, then the second one is considered
+       *
+       * \param s a const pointer to a slice whose lower bound is before \f$t\f$
+       * \param t the temporal key
+       * \return a const pointer to the slice defined at \f$t\f$
+       */
+      static const Slice* sweep_to(const Slice *s, double t);
+
+      /**
+       * \brief Returns the interval evaluation of a tube over \f$[t]\f$,
+       *        starting the evaluation from a slice already reached by the sweep
+       *
+       * \param s a const pointer to the slice defined at \f$t^-\f$
+       * \param t the subtdomain
+       * \return Interval envelope \f$[y]([t])\f$
+       */
+      static const ibex::Interval sweep_eval(const Slice *s, const ibex::Interval& t);
+
+      /**
+       * \brief Returns the hull of the interval inversion \f$[y]^{-1}([z])\f$ over \f$[t]\f$,
+       *        starting the inversion from a slice already reached by the sweep
+       *
+       * \note Contrary to Tube::invert(), no derivative tube is built for this purpose
+       *
+       * \param s a const pointer to the slice defined at \f$t^-\f$
+       * \param z the interval codomain
+       * \param t the non-degenerated subtdomain on which the inversion is performed
+       * \return the hull of \f$[y]^{-1}([z])\cap[t]\f$
+       */
+      static const ibex::Interval sweep_invert(const Slice *s, const ibex::Interval& z, const ibex::Interval& t);
   };
 }
 
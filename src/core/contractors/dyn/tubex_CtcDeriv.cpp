@@ -17,6 +17,17 @@ using namespace ibex;
 
 namespace tubex
 {
+  // Gate significantly contracted, with respect to a tolerance on its bounds
+
+    static bool contracted(const Interval& before, const Interval& after, double eps)
+    {
+      if(after == before)
+        return false;
+      if(after.is_empty())
+        return true;
+      return after.lb() - before.lb() > eps || before.ub() - after.ub() > eps;
+    }
+
   CtcDeriv::CtcDeriv()
     : DynCtc(false)
   {
@@ -100,6 +111,50 @@ namespace tubex
       contract(x[i], v[i], t_propa);
   }
 
+  void CtcDeriv::contract(Tube& x, const Tube& v, const Interval& t_dirty, TimePropag t_propa)
+  {
+    assert(x.tdomain() == v.tdomain());
+    assert(Tube::same_slicing(x, v));
+    assert(x.tdomain().is_superset(t_dirty));
+
+    if(t_dirty.is_empty())
+      return;
+
+    vector<Slice*> v_x(1, x.slice(t_dirty.lb()));
+    vector<const Slice*> v_v(1, v.slice(t_dirty.lb()));
+    contract_from(v_x, v_v, t_dirty, t_propa);
+  }
+
+  void CtcDeriv::contract(TubeVector& x, const TubeVector& v, const Interval& t_dirty, TimePropag t_propa)
+  {
+    assert(x.size() == v.size());
+    assert(x.tdomain() == v.tdomain());
+    assert(TubeVector::same_slicing(x, v));
+    assert(x.tdomain().is_superset(t_dirty));
+    #ifndef NDEBUG
+      for(int i = 1 ; i < x.size() ; i++)
+        assert(Tube::same_slicing(x[0], x[i]));
+    #endif
+
+    if(t_dirty.is_empty())
+      return;
+
+    vector<Slice*> v_x(x.size());
+    vector<const Slice*> v_v(x.size());
+    for(int i = 0 ; i < x.size() ; i++)
+    {
+      v_x[i] = x[i].slice(t_dirty.lb());
+      v_v[i] = v[i].slice(t_dirty.lb());
+    }
+    contract_from(v_x, v_v, t_dirty, t_propa);
+  }
+
+  void CtcDeriv::set_propagation_tolerance(double eps)
+  {
+    assert(eps >= 0.);
+    m_propa_eps = eps;
+  }
+
   void CtcDeriv::contract(Slice& x, const Slice& v, TimePropag t_propa)
   {
     assert(x.tdomain() == v.tdomain());
@@ -198,4 +253,95 @@ namespace tubex
     in_gate &= out_gate_proj;
     x.set_input_gate(in_gate);
   }
-}
\ No newline at end of file
+
+  void CtcDeriv::contract_from(vector<Slice*>& v_x, vector<const Slice*>& v_v, const Interval& t_dirty, TimePropag t_propa)
+  {
+    const size_t n = v_x.size();
+
+    // First slice touching the updated tdomain (a gate may have been updated)
+
+      while(v_x[0]->prev_slice() != NULL && v_x[0]->prev_slice()->tdomain().intersects(t_dirty))
+        for(size_t i = 0 ; i < n ; i++)
+        {
+          v_x[i] = v_x[i]->prev_slice();
+          v_v[i] = v_v[i]->prev_slice();
+        }
+
+    // Input gates of the first slice, and output gates of the slices
+    // contracted forward: values last seen by the previous slices
+
+      vector<vector<Interval> > v_gates(1, vector<Interval>(n));
+      for(size_t i = 0 ; i < n ; i++)
+        v_gates[0][i] = v_x[i]->input_gate();
+
+    // Forward contractions, until the output gates remain unchanged
+
+      if(t_propa & TimePropag::FORWARD)
+      {
+        while(true)
+        {
+          bool changed = false;
+          v_gates.push_back(vector<Interval>(n));
+
+          for(size_t i = 0 ; i < n ; i++)
+          {
+            const Interval outgate = v_x[i]->output_gate();
+            contract(*v_x[i], *v_v[i], t_propa);
+            v_gates.back()[i] = v_x[i]->output_gate();
+            changed |= contracted(outgate, v_x[i]->output_gate(), m_propa_eps);
+          }
+
+          if((!changed && !v_x[0]->tdomain().intersects(t_dirty)) || v_x[0]->next_slice() == NULL)
+            break;
+
+          for(size_t i = 0 ; i < n ; i++)
+          {
+            v_x[i] = v_x[i]->next_slice();
+            v_v[i] = v_v[i]->next_slice();
+          }
+        }
+      }
+
+      else // last slice touching the updated tdomain
+      {
+        while(v_x[0]->next_slice() != NULL && v_x[0]->next_slice()->tdomain().intersects(t_dirty))
+          for(size_t i = 0 ; i < n ; i++)
+          {
+            v_x[i] = v_x[i]->next_slice();
+            v_v[i] = v_v[i]->next_slice();
+          }
+      }
+
+    // Backward contractions, from the last slice contracted forward and
+    // until the input gates remain unchanged for the previous slices
+
+      if(t_propa & TimePropag::BACKWARD)
+      {
+        // Slices contracted forward: their output gates are in v_gates[1..]
+        int k = (int)v_gates.size() - 2;
+
+        while(v_x[0] != NULL)
+        {
+          bool changed = false;
+
+          for(size_t i = 0 ; i < n ; i++)
+          {
+            const Interval ingate = k >= 0 ? v_gates[k][i] : v_x[i]->input_gate();
+            contract(*v_x[i], *v_v[i], t_propa);
+            changed |= contracted(ingate, v_x[i]->input_gate(), m_propa_eps);
+          }
+
+          if(!changed && !v_x[0]->tdomain().intersects(t_dirty) && k <= 0)
+            break;
+
+          for(size_t i = 0 ; i < n ; i++)
+          {
+            v_x[i] = v_x[i]->prev_slice();
+            if(v_x[i] != NULL)
+              v_v[i] = v_v[i]->prev_slice();
+          }
+          k--;
+        }
+      }
+  }
+}
@@ -83,8 +83,64 @@ namespace tubex
        */
       void contract(Slice& x, const Slice& v, TimePropag t_propa = TimePropag::FORWARD | TimePropag::BACKWARD);
 
+      /**
+       * \brief \f$\mathcal{C}_{\frac{d}{dt}}\big([x](\cdot),[v](\cdot)\big)\f$ after a local update of the tubes:
+       *        the propagation starts from the slices of \f$[t_d]\f$ and stops as soon as the gates remain unchanged.
+       *
+       * The contraction is then in O(affected slices) instead of O(n). The result is the one of
+       * a complete contraction if the tubes were consistent before the update, and if no tolerance
+       * is set (see set_propagation_tolerance()).
+       *
+       * \note The first updated slice is found in logarithmic time if the synthesis tree
+       *       of \f$[x](\cdot)\f$ has been enabled (see Tube::enable_synthesis()).
+       *
+       * \pre \f$[x](\cdot)\f$ and \f$[v](\cdot)\f$ must share the same slicing and tdomain.
+       *
+       * \param x the scalar tube \f$[x](\cdot)\f$
+       * \param v the scalar derivative tube \f$[v](\cdot)\f$
+       * \param t_dirty the temporal domain \f$[t_d]\f$ of the slices that have been updated
+       * \param t_propa an optional temporal way of propagation
+       *                (forward or backward in time, both ways by default)
+       */
+      void contract(Tube& x, const Tube& v, const ibex::Interval& t_dirty, TimePropag t_propa = TimePropag::FORWARD | TimePropag::BACKWARD);
+
+      /**
+       * \brief \f$\mathcal{C}_{\frac{d}{dt}}\big([\mathbf{x}](\cdot),[\mathbf{v}](\cdot)\big)\f$ after a local update of the tubes:
+       *        the propagation starts from the slices of \f$[t_d]\f$ and stops as soon as the gates remain unchanged.
+       *
+       * The components are contracted together, in a single pass over the slices.
+       *
+       * \pre \f$[\mathbf{x}](\cdot)\f$ and \f$[\mathbf{v}](\cdot)\f$ must share the same dimension and tdomain,
+       *      and all their components the same slicing.
+       *
+       * \param x the n-dimensional tube \f$[\mathbf{x}](\cdot)\f$
+       * \param v the n-dimensional derivative tube \f$[\mathbf{v}](\cdot)\f$
+       * \param t_dirty the temporal domain \f$[t_d]\f$ of the slices that have been updated
+       * \param t_propa an optional temporal way of propagation
+       *                (forward or backward in time, both ways by default)
+       */
+      void contract(TubeVector& x, const TubeVector& v, const ibex::Interval& t_dirty, TimePropag t_propa = TimePropag::FORWARD | TimePropag::BACKWARD);
+
+      /**
+       * \brief Sets the tolerance below which a gate is considered as unchanged,
+       *        for the propagations from updated slices
+       *
+       * \param eps the tolerance on the bounds of the gates (0 by default)
+       */
+      void set_propagation_tolerance(double eps);
+
     protected:
 
+      /**
+       * \brief Propagation from the slices of \f$[t_d]\f$, for all the components at once
+       *
+       * \param v_x the slices of the components of \f$[\mathbf{x}](\cdot)\f$ at \f$t_d^-\f$
+       * \param v_v the slices of the components of \f$[\mathbf{v}](\cdot)\f$ at \f$t_d^-\f$
+       * \param t_dirty the temporal domain \f$[t_d]\f$ of the slices that have been updated
+       * \param t_propa temporal way of propagation
+       */
+      void contract_from(std::vector<Slice*>& v_x, std::vector<const Slice*>& v_v, const ibex::Interval& t_dirty, TimePropag t_propa);
+
       /**
        * \brief Contracts input and output gates of a slice regarding its derivative set
        *
@@ -97,6 +153,8 @@ namespace tubex
        * \param v the derivative slice \f$\llbracket v\rrbracket(\cdot)\f$
        */
       void contract_gates(Slice& x, const Slice& v);
+
+      double m_propa_eps = 0.; //!< tolerance on the gates for the propagations from updated slices
       
       friend class CtcEval; // contract_gates used by CtcEval
   };
@@ -388,6 +388,137 @@ namespace tubex
 
     t &= t_result;
   }
+
+  void CtcEval::contract(const vector<double>& v_t, vector<Interval>& v_z, Tube& y, Tube& w)
+  {
+    assert(v_t.size() == v_z.size());
+    assert(y.tdomain() == w.tdomain());
+    assert(Tube::same_slicing(y, w));
+
+    if(v_t.empty())
+      return;
+
+    if(!m_propagation_enabled)
+    {
+      // Local contractions only: no benefit from a common propagation
+      for(size_t i = 0 ; i < v_t.size() ; i++)
+        contract(v_t[i], v_z[i], y, w);
+      return;
+    }
+
+    bool empty = y.is_empty() || w.is_empty();
+    vector<double> v_added_gates; // to be removed after the contraction, for preserving the slicing
+
+    // 1. Setting all the gates, in one sweep over the slices
+
+      Slice *s_y = y.first_slice(), *s_w = w.first_slice();
+
+      for(size_t i = 0 ; i < v_t.size() && !empty ; i++)
+      {
+        double t = v_t[i];
+        assert(!std::isnan(t));
+        assert(y.tdomain().contains(t));
+        assert((i == 0 || v_t[i-1] <= t) && "dates must be sorted");
+
+        while(s_y->next_slice() != NULL && t >= s_y->tdomain().ub())
+        {
+          s_y = s_y->next_slice();
+          s_w = s_w->next_slice();
+        }
+
+        if(t == s_y->tdomain().lb() || t == s_y->tdomain().ub())
+          v_z[i] &= (*s_y)(t);
+
+        else
+        {
+          v_z[i] &= s_y->interpol(t, *s_w);
+          if(m_preserve_slicing)
+            v_added_gates.push_back(t);
+        }
+
+        y.sample(t, s_y);
+        w.sample(t, s_w); // w is also sampled to stay compliant with y
+
+        if(t == s_y->tdomain().lb())
+          s_y->set_input_gate(v_z[i]);
+        else
+          s_y->set_output_gate(v_z[i]);
+
+        empty = v_z[i].is_empty();
+      }
+
+      assert(Tube::same_slicing(y, w));
+
+    // 2. Single forward/backward propagation
+
+      if(!empty)
+      {
+        CtcDeriv ctc_deriv;
+        ctc_deriv.restrict_tdomain(m_restricted_tdomain);
+        ctc_deriv.set_fast_mode(m_fast_mode);
+        ctc_deriv.contract(y, w);
+        empty = y.is_empty();
+      }
+
+    // 3. Evaluations contraction
+
+      s_y = y.first_slice();
+
+      for(size_t i = 0 ; i < v_t.size() && !empty ; i++)
+      {
+        while(s_y->next_slice() != NULL && v_t[i] >= s_y->tdomain().ub())
+          s_y = s_y->next_slice();
+
+        v_z[i] &= (*s_y)(v_t[i]);
+        empty = v_z[i].is_empty();
+      }
+
+    // 4. Merge of the added slices, the contractions being kept in their envelopes
+
+      if(!empty && !v_added_gates.empty())
+      {
+        for(const auto& t : v_added_gates)
+        {
+          y.remove_gate(t);
+          w.remove_gate(t);
+        }
+
+        y.delete_synthesis_tree(); // todo: update tree if created, instead of delete
+        w.delete_synthesis_tree(); // todo: update tree if created, instead of delete
+      }
+
+    if(empty)
+    {
+      for(size_t i = 0 ; i < v_z.size() ; i++)
+        v_z[i].set_empty();
+      y.set_empty();
+      w.set_empty();
+    }
+  }
+
+  void CtcEval::contract(const vector<double>& v_t, vector<IntervalVector>& v_z, TubeVector& y, TubeVector& w)
+  {
+    assert(v_t.size() == v_z.size());
+    assert(y.size() == w.size());
+    assert(y.tdomain() == w.tdomain());
+    assert(TubeVector::same_slicing(y, w));
+
+    vector<Interval> v_zi(v_z.size());
+
+    for(int i = 0 ; i < y.size() ; i++)
+    {
+      for(size_t k = 0 ; k < v_z.size() ; k++)
+      {
+        assert(v_z[k].size() == y.size());
+        v_zi[k] = v_z[k][i];
+      }
+
+      contract(v_t, v_zi, y[i], w[i]);
+
+      for(size_t k = 0 ; k < v_z.size() ; k++)
+        v_z[k][i] = v_zi[k];
+    }
+  }
 /*
   void CtcEval::contract(const Interval& t, const IntervalVector& z, TubeVector& y, TubeVector& w)
   {
@@ -102,6 +102,37 @@ namespace tubex
        */
       void contract(ibex::Interval& t, ibex::IntervalVector& z, TubeVector& y, TubeVector& w);
 
+      /**
+       * \brief \f$\mathcal{C}_\textrm{eval}\big(\{t_i\},\{[z_i]\},[y](\cdot),[w](\cdot)\big)\f$:
+       *        contracts the tube \f$[y](\cdot)\f$ and a set of evaluations \f$[z_i]\f$.
+       *
+       * \note All the gates are set before a single forward/backward propagation,
+       *       so that the cost is linear in the number of slices and observations,
+       *       instead of a propagation for each evaluation.
+       * \note The gates added at the dates \f$t_i\f$ are removed after the contraction
+       *       if the slicing is preserved (see DynCtc::preserve_slicing).
+       *
+       * \param v_t the dates \f$t_i\f$ of the evaluations, sorted in ascending order
+       * \param v_z the bounded evaluations \f$[z_i]\f$
+       * \param y the scalar tube \f$[y](\cdot)\f$
+       * \param w the scalar derivative tube \f$[w](\cdot)\f$
+       */
+      void contract(const std::vector<double>& v_t, std::vector<ibex::Interval>& v_z, Tube& y, Tube& w);
+
+      /**
+       * \brief \f$\mathcal{C}_\textrm{eval}\big(\{t_i\},\{[\mathbf{z}_i]\},[\mathbf{y}](\cdot),[\mathbf{w}](\cdot)\big)\f$:
+       *        contracts the tube \f$[\mathbf{y}](\cdot)\f$ and a set of evaluations \f$[\mathbf{z}_i]\f$.
+       *
+       * \note The gates added at the dates \f$t_i\f$ are removed after the contraction
+       *       if the slicing is preserved (see DynCtc::preserve_slicing).
+       *
+       * \param v_t the dates \f$t_i\f$ of the evaluations, sorted in ascending order
+       * \param v_z the bounded evaluations \f$[\mathbf{z}_i]\f$
+       * \param y the n-dimensional tube \f$[\mathbf{y}](\cdot)\f$
+       * \param w the n-dimensional derivative tube \f$[\mathbf{w}](\cdot)\f$
+       */
+      void contract(const std::vector<double>& v_t, std::vector<ibex::IntervalVector>& v_z, TubeVector& y, TubeVector& w);
+
       /**
        * \brief \f$\mathcal{C}_\textrm{eval}\big([t],[z],[y](\cdot)\big)\f$:
        *        contracts the evaluation \f$[t]\times[z]\f$ only.
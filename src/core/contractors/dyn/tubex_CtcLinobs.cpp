@@ -35,8 +35,23 @@ namespace tubex
 
   void CtcLinobs::contract(TubeVector& x, const Tube& u, TimePropag t_propa)
   {
-    vector<ConvexPolygon> v_p_k;
-    contract(x, u, v_p_k, t_propa);
+    if(m_incremental)
+      contract_incremental(x, u, t_propa);
+
+    else
+    {
+      vector<ConvexPolygon> v_p_k;
+      contract(x, u, v_p_k, t_propa);
+    }
+  }
+
+  void CtcLinobs::set_incremental_mode(bool incremental)
+  {
+    m_incremental = incremental;
+    m_x_ref = NULL; // polygons to be computed anew
+    m_u_ref = NULL;
+    m_v_t.clear();
+    m_v_p_k.clear();
   }
 
   void CtcLinobs::contract(TubeVector& x, const Tube& u, vector<ConvexPolygon>& v_p_k, TimePropag t_propa)
@@ -120,11 +135,11 @@ namespace tubex
 
           if(tkm1_tk.intersects(m_restricted_tdomain))
           {
-            ctc_fwd_gate(v_p_k[i], v_p_k[i-1], tkm1_tk.diam(), m_A, m_b, su->codomain());
+            ctc_fwd_gate(v_p_k[i], v_p_k[i-1], tkm1_tk.diam(), su->codomain());
 
             for(size_t j = 0 ; j < v_t.size() ; j++) // observations at uncertain times
               if(tkm1_tk.contains(v_t[j]))
-                ctc_fwd_gate(v_p_k[i], ConvexPolygon(v_y[j]), tkm1_tk.ub()-v_t[j], m_A, m_b, su->codomain());
+                ctc_fwd_gate(v_p_k[i], ConvexPolygon(v_y[j]), tkm1_tk.ub()-v_t[j], su->codomain());
             // todo: contraction of the observations
 
             IntervalVector ouputgate_box = v_p_k[i].box();
@@ -139,7 +154,7 @@ namespace tubex
 
             else
             {
-              IntervalVector envelope_box = polygon_envelope(v_p_k[i-1], tkm1_tk.diam(), m_A, m_b, su->codomain()).box();
+              IntervalVector envelope_box = polygon_envelope(v_p_k[i-1], tkm1_tk.diam(), su->codomain()).box();
               s0->set_envelope(envelope_box[0]);
               s1->set_envelope(envelope_box[1]);
             }
@@ -165,18 +180,18 @@ namespace tubex
 
           if(tk_kp1.intersects(m_restricted_tdomain))
           {
-            ctc_bwd_gate(v_p_k[i], v_p_k[i+1], tk_kp1.diam(), m_A, m_b, su->codomain());
+            ctc_bwd_gate(v_p_k[i], v_p_k[i+1], tk_kp1.diam(), su->codomain());
 
             for(size_t j = 0 ; j < v_t.size() ; j++) // observations at uncertain times
               if(tk_kp1.contains(v_t[j]))
-                ctc_bwd_gate(v_p_k[i], ConvexPolygon(v_y[j]), v_t[j]-tk_kp1.lb(), m_A, m_b, su->codomain());
+                ctc_bwd_gate(v_p_k[i], ConvexPolygon(v_y[j]), v_t[j]-tk_kp1.lb(), su->codomain());
             // todo: contraction of the observations
 
             IntervalVector polybox = v_p_k[i].box();
             s0->set_input_gate(polybox[0]);
             s1->set_input_gate(polybox[1]);
 
-            IntervalVector envelope_box = polygon_envelope(v_p_k[i], tk_kp1.diam(), m_A, m_b, su->codomain()).box();
+            IntervalVector envelope_box = polygon_envelope(v_p_k[i], tk_kp1.diam(), su->codomain()).box();
             s0->set_envelope(envelope_box[0]);
             s1->set_envelope(envelope_box[1]);
           }
@@ -187,23 +202,250 @@ namespace tubex
       }
   }
 
+  void CtcLinobs::contract_incremental(TubeVector& x, const Tube& u, TimePropag t_propa)
+  {
+    assert(x.size() == 2 && "operation not supported for other dimensions");
+    assert(Tube::same_slicing(x[0], u));
+    assert(Tube::same_slicing(x[1], u));
+
+    int k = x[0].nb_slices();
+    int i;
+    const Slice *su;
+    Slice *s0, *s1;
+
+    if(x.is_empty()) // polygons cannot be built from empty gates
+    {
+      x.set_empty();
+      set_incremental_mode(); // the kept polygons are discarded
+      return;
+    }
+
+    // Changes since the previous contraction: the polygons of the contracted
+    // gates are intersected with them, and the slices concerned will be
+    // processed again. Any enlargement, or another slicing (the same tube
+    // object may have been reassigned), leads to a complete contraction.
+
+      bool reset = m_x_ref != &x || m_u_ref != &u || (int)m_v_p_k.size() != k+1;
+
+      if(!reset)
+      {
+        s0 = x[0].first_slice(); s1 = x[1].first_slice(); su = u.first_slice();
+
+        for(i = 0 ; !reset && i <= k ; i++)
+        {
+          if(m_v_t[i] != (i == 0 ? s0->tdomain().lb() : s0->tdomain().ub()))
+          {
+            reset = true;
+            break;
+          }
+
+          IntervalVector gate(2);
+          gate[0] = i == 0 ? s0->input_gate() : s0->output_gate();
+          gate[1] = i == 0 ? s1->input_gate() : s1->output_gate();
+
+          if(gate != m_v_gates[i])
+          {
+            if(!gate.is_subset(m_v_gates[i]))
+              reset = true;
+
+            else
+            {
+              m_v_p_k[i] = m_v_p_k[i] & gate;
+              m_v_gates[i] = gate;
+              if(i < k) { m_v_fwd[i] = true; m_v_env[i] = true; }
+              if(i > 0) m_v_bwd[i-1] = true;
+            }
+          }
+
+          if(i < k && su->codomain() != m_v_u[i])
+          {
+            if(!su->codomain().is_subset(m_v_u[i]))
+              reset = true;
+
+            else
+            {
+              m_v_u[i] = su->codomain();
+              m_v_fwd[i] = true; m_v_bwd[i] = true; m_v_env[i] = true;
+            }
+          }
+
+          if(i > 0) // the gate i>0 is the output gate of the slice i-1
+          {
+            s0 = s0->next_slice(); s1 = s1->next_slice();
+          }
+          if(i < k)
+            su = su->next_slice();
+        }
+      }
+
+    // Polygons computed from the gates, as for a complete contraction
+
+      if(reset)
+      {
+        // Unbounded polygons are not supported yet, so we limit their size
+        IntervalVector box_domain(2, Interval(-9999.,9999.));
+        x &= box_domain;
+
+        m_x_ref = &x;
+        m_u_ref = &u;
+        m_v_t = vector<double>(k+1);
+        m_v_p_k = vector<ConvexPolygon>(k+1);
+        m_v_gates = vector<IntervalVector>(k+1, IntervalVector(2));
+        m_v_u = vector<Interval>(k);
+        m_v_fwd = m_v_bwd = m_v_env = vector<bool>(k, true);
+
+        s0 = x[0].first_slice(); s1 = x[1].first_slice(); su = u.first_slice();
+        m_v_t[0] = s0->tdomain().lb();
+        m_v_gates[0][0] = s0->input_gate(); m_v_gates[0][1] = s1->input_gate();
+        m_v_p_k[0] = ConvexPolygon(m_v_gates[0]);
+
+        for(i = 1 ; i <= k ; i++)
+        {
+          m_v_t[i] = s0->tdomain().ub();
+          m_v_gates[i][0] = s0->output_gate(); m_v_gates[i][1] = s1->output_gate();
+          m_v_p_k[i] = ConvexPolygon(m_v_gates[i]);
+          m_v_u[i-1] = su->codomain();
+          s0 = s0->next_slice(); s1 = s1->next_slice(); su = su->next_slice();
+        }
+      }
+
+    // Forward contractions
+
+      if(t_propa & TimePropag::FORWARD)
+      {
+        s0 = x[0].first_slice(); s1 = x[1].first_slice(); su = u.first_slice();
+
+        for(i = 0 ; i < k ; i++)
+        {
+          const Interval tk_kp1 = s0->tdomain();
+
+          if(m_v_fwd[i] && tk_kp1.intersects(m_restricted_tdomain))
+          {
+            const ConvexPolygon p_prev(m_v_p_k[i+1]);
+            ctc_fwd_gate(m_v_p_k[i+1], m_v_p_k[i], tk_kp1.diam(), su->codomain());
+            m_v_fwd[i] = false;
+
+            if(m_v_p_k[i+1] != p_prev) // propagation to the neighbouring slices
+            {
+              IntervalVector outputgate_box = m_v_p_k[i+1].box();
+              s0->set_output_gate(s0->output_gate() & outputgate_box[0]);
+              s1->set_output_gate(s1->output_gate() & outputgate_box[1]);
+              m_v_gates[i+1][0] = s0->output_gate(); m_v_gates[i+1][1] = s1->output_gate();
+
+              m_v_bwd[i] = true;
+              if(i+1 < k) { m_v_fwd[i+1] = true; m_v_env[i+1] = true; }
+            }
+          }
+
+          s0 = s0->next_slice(); s1 = s1->next_slice(); su = su->next_slice();
+        }
+      }
+
+    // Backward contractions
+
+      if(t_propa & TimePropag::BACKWARD)
+      {
+        s0 = x[0].last_slice(); s1 = x[1].last_slice(); su = u.last_slice();
+
+        for(i = k-1 ; i >= 0 ; i--)
+        {
+          const Interval tk_kp1 = s0->tdomain();
+
+          if(m_v_bwd[i] && tk_kp1.intersects(m_restricted_tdomain))
+          {
+            const ConvexPolygon p_prev(m_v_p_k[i]);
+            ctc_bwd_gate(m_v_p_k[i], m_v_p_k[i+1], tk_kp1.diam(), su->codomain());
+            m_v_bwd[i] = false;
+
+            if(m_v_p_k[i] != p_prev) // propagation to the neighbouring slices
+            {
+              IntervalVector inputgate_box = m_v_p_k[i].box();
+              s0->set_input_gate(s0->input_gate() & inputgate_box[0]);
+              s1->set_input_gate(s1->input_gate() & inputgate_box[1]);
+              m_v_gates[i][0] = s0->input_gate(); m_v_gates[i][1] = s1->input_gate();
+
+              m_v_fwd[i] = true; m_v_env[i] = true;
+              if(i > 0) m_v_bwd[i-1] = true;
+            }
+          }
+
+          s0 = s0->prev_slice(); s1 = s1->prev_slice(); su = su->prev_slice();
+        }
+      }
+
+    // Envelopes of the slices whose input gate or input has been contracted
+
+      s0 = x[0].first_slice(); s1 = x[1].first_slice(); su = u.first_slice();
+
+      for(i = 0 ; i < k ; i++)
+      {
+        const Interval tk_kp1 = s0->tdomain();
+
+        if(m_v_env[i] && tk_kp1.intersects(m_restricted_tdomain))
+        {
+          IntervalVector envelope_box = polygon_envelope(m_v_p_k[i], tk_kp1.diam(), su->codomain()).box();
+          s0->set_envelope(s0->codomain() & envelope_box[0]);
+          s1->set_envelope(s1->codomain() & envelope_box[1]);
+          m_v_env[i] = false;
+
+          // The gates may have been contracted by the new envelope: m_v_gates
+          // is not updated, so that the next contraction processes them again
+        }
+
+        s0 = s0->next_slice(); s1 = s1->next_slice(); su = su->next_slice();
+      }
+  }
+
+  const IntervalMatrix& CtcLinobs::exp_At(double dt, ExpAtTerm term)
+  {
+    auto it = m_exp.find(dt);
+    if(it == m_exp.end())
+    {
+      if(m_exp.size() >= EXP_CACHE_SIZE) // non-uniform slicing, or observations
+        m_exp.clear();
+      it = m_exp.insert(make_pair(dt, ExpAt())).first;
+    }
+
+    // Only the exponentials needed by the contractions are computed:
+    // a forward propagation does not involve e^{-At}
+    ExpAt& e = it->second;
+    if(!e.computed[term])
+    {
+      switch(term)
+      {
+        case E_DT: e.e[term] = m_exp_At(m_A, Interval(dt)); break;
+        case E_0DT: e.e[term] = m_exp_At(m_A, Interval(0.,dt)); break;
+        case E_M_DT: e.e[term] = m_exp_At(-m_A, Interval(dt)); break;
+        case E_M_0DT: e.e[term] = m_exp_At(-m_A, Interval(0.,dt)); break;
+      }
+      e.computed[term] = true;
+    }
+
+    return e.e[term];
+  }
+
   void CtcLinobs::ctc_fwd_gate(ConvexPolygon& p_k, const ConvexPolygon& p_km1,
-    double dt_km1_k, const Matrix& A, const Vector& b, const Interval& u_km1)
+    double dt_km1_k, const Interval& u_km1)
   {
-    p_k = p_k & (m_exp_At(A,dt_km1_k)*p_km1 + dt_km1_k*m_exp_At(A,Interval(0.,dt_km1_k))*(u_km1*b));
+    const IntervalMatrix& e_dt = exp_At(dt_km1_k, E_DT);
+    const IntervalMatrix& e_0dt = exp_At(dt_km1_k, E_0DT);
+    p_k = p_k & (e_dt*p_km1 + dt_km1_k*e_0dt*(u_km1*m_b));
     p_k.simplify(m_polygon_max_edges);
   }
 
   void CtcLinobs::ctc_bwd_gate(ConvexPolygon& p_k, const ConvexPolygon& p_kp1,
-    double dt_k_kp1, const Matrix& A, const Vector& b, const Interval& u_k)
+    double dt_k_kp1, const Interval& u_k)
   {
-    p_k = p_k & (m_exp_At(-A,dt_k_kp1)*p_kp1 - dt_k_kp1*m_exp_At(-A,Interval(0.,dt_k_kp1))*(u_k*b));
+    const IntervalMatrix& e_m_dt = exp_At(dt_k_kp1, E_M_DT);
+    const IntervalMatrix& e_m_0dt = exp_At(dt_k_kp1, E_M_0DT);
+    p_k = p_k & (e_m_dt*p_kp1 - dt_k_kp1*e_m_0dt*(u_k*m_b));
     p_k.simplify(m_polygon_max_edges);
   }
 
   ConvexPolygon CtcLinobs::polygon_envelope(const ConvexPolygon& p_k,
-    double dt_k_kp1, const Matrix& A, const Vector& b, const Interval& u_k)
+    double dt_k_kp1, const Interval& u_k)
   {
-    return m_exp_At(A,Interval(0.,dt_k_kp1))*p_k + Interval(0.,dt_k_kp1)*m_exp_At(A,Interval(0.,dt_k_kp1))*(u_k*b);
+    const IntervalMatrix& e_0dt = exp_At(dt_k_kp1, E_0DT);
+    return e_0dt*p_k + Interval(0.,dt_k_kp1)*e_0dt*(u_k*m_b);
   }
-}
\ No newline at end of file
+}
@@ -45,21 +45,77 @@ namespace tubex
       void contract(std::vector<double>& v_t, std::vector<ibex::IntervalVector>& v_y, TubeVector& x, const Tube& u, TimePropag t_propa = TimePropag::FORWARD | TimePropag::BACKWARD);
       void contract(std::vector<double>& v_t, std::vector<ibex::IntervalVector>& v_y, TubeVector& x, const Tube& u, std::vector<ConvexPolygon>& v_p_k, TimePropag t_propa = TimePropag::FORWARD | TimePropag::BACKWARD);
 
+      /**
+       * \brief Enables an incremental mode, for repeated contractions of the same tubes
+       *
+       * The polygons of the gates are then kept from one call to the next, and only
+       * the slices whose gates or inputs have been contracted in the meantime (including
+       * by the envelopes computed in the previous call) are processed again:
+       * repeated contractions, for instance in a contractor network,
+       * cost O(changed slices) polygon operations. The polygons are computed anew if one
+       * of the tubes has been enlarged, or if its slicing has changed. Polygons kept for
+       * a previous tube remain valid enclosures for any tube with the same slicing and
+       * smaller gates and inputs. This mode only concerns the contractions without
+       * observations and without output of the polygons.
+       *
+       * Calling this method again discards the polygons kept so far.
+       *
+       * \param incremental if true, incremental mode enabled
+       */
+      void set_incremental_mode(bool incremental = true);
+
 
     protected:
 
-      void ctc_fwd_gate(ConvexPolygon& p_k, const ConvexPolygon& p_km1, double dt_km1_k, const ibex::Matrix& A, const ibex::Vector& b, const ibex::Interval& u_km1);
-      void ctc_bwd_gate(ConvexPolygon& p_k, const ConvexPolygon& p_kp1, double dt_k_kp1, const ibex::Matrix& A, const ibex::Vector& b, const ibex::Interval& u_k);
+      /**
+       * \brief Matrix exponentials involved over a time step \f$\delta\f$
+       */
+      enum ExpAtTerm
+      {
+        E_DT = 0, //!< \f$e^{\mathbf{A}\delta}\f$
+        E_0DT, //!< \f$e^{\mathbf{A}[0,\delta]}\f$
+        E_M_DT, //!< \f$e^{-\mathbf{A}\delta}\f$
+        E_M_0DT //!< \f$e^{-\mathbf{A}[0,\delta]}\f$
+      };
 
-      ConvexPolygon polygon_envelope(const ConvexPolygon& p_k, double dt_k_kp1, const ibex::Matrix& A, const ibex::Vector& b, const ibex::Interval& u_k);
+      /**
+       * \brief Enclosures of the matrix exponentials over a time step, computed on demand
+       */
+      struct ExpAt
+      {
+        std::vector<ibex::IntervalMatrix> e = std::vector<ibex::IntervalMatrix>(4, ibex::IntervalMatrix(2,2));
+        bool computed[4] = { false, false, false, false };
+      };
+
+      const ibex::IntervalMatrix& exp_At(double dt, ExpAtTerm term);
+
+      void ctc_fwd_gate(ConvexPolygon& p_k, const ConvexPolygon& p_km1, double dt_km1_k, const ibex::Interval& u_km1);
+      void ctc_bwd_gate(ConvexPolygon& p_k, const ConvexPolygon& p_kp1, double dt_k_kp1, const ibex::Interval& u_k);
+
+      ConvexPolygon polygon_envelope(const ConvexPolygon& p_k, double dt_k_kp1, const ibex::Interval& u_k);
+
+      void contract_incremental(TubeVector& x, const Tube& u, TimePropag t_propa);
 
     protected:
 
-      const ibex::Matrix& m_A;
-      const ibex::Vector& m_b;
+      const ibex::Matrix m_A; //!< copy of the matrix, on which the cached exponentials depend
+      const ibex::Vector m_b;
       ibex::IntervalMatrix (*m_exp_At)(const ibex::Matrix& A, const ibex::Interval& t);
+      std::map<double,ExpAt> m_exp; //!< exponentials already computed, by time step
 
       const int m_polygon_max_edges = 15;
+
+      // Incremental mode
+      bool m_incremental = false;
+      const TubeVector *m_x_ref = NULL; //!< tube of the polygons kept in incremental mode
+      const Tube *m_u_ref = NULL; //!< input tube of the polygons kept in incremental mode
+      std::vector<double> m_v_t; //!< times of the (k+1) gates, for checking the slicing
+      std::vector<ConvexPolygon> m_v_p_k; //!< polygons of the (k+1) gates
+      std::vector<ibex::IntervalVector> m_v_gates; //!< gates at the end of the previous contraction
+      std::vector<ibex::Interval> m_v_u; //!< inputs at the end of the previous contraction
+      std::vector<bool> m_v_fwd, m_v_bwd, m_v_env; //!< slices to be processed again, by way of propagation
+
+      static const size_t EXP_CACHE_SIZE = 64; //!< maximal number of time steps in the cache
   };
 }
 
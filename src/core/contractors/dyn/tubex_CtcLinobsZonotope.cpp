@@ -0,0 +1,345 @@
+/** 
+ *  CtcLinobsZonotope class
+ * ----------------------------------------------------------------------------
+ *  \date       2020
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2020 Simon Rohou
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#include <numeric>
+#include <algorithm>
+#include "tubex_CtcLinobsZonotope.h"
+#include "tubex_Domain.h"
+#include "tubex_zonotope_arithmetic.h"
+
+using namespace std;
+using namespace ibex;
+
+namespace tubex
+{
+  // Slices of the components of a tube vector at the same time
+
+    static IntervalVector input_gate(const vector<Slice*>& v_s)
+    {
+      IntervalVector gate(v_s.size());
+      for(size_t i = 0 ; i < v_s.size() ; i++)
+        gate[i] = v_s[i]->input_gate();
+      return gate;
+    }
+
+    static IntervalVector output_gate(const vector<Slice*>& v_s)
+    {
+      IntervalVector gate(v_s.size());
+      for(size_t i = 0 ; i < v_s.size() ; i++)
+        gate[i] = v_s[i]->output_gate();
+      return gate;
+    }
+
+    static IntervalVector codomain(const vector<const Slice*>& v_s)
+    {
+      IntervalVector codomain(v_s.size());
+      for(size_t i = 0 ; i < v_s.size() ; i++)
+        codomain[i] = v_s[i]->codomain();
+      return codomain;
+    }
+
+    template<typename T>
+    static void next_slices(vector<T*>& v_s)
+    {
+      for(auto& s : v_s)
+        s = s->next_slice();
+    }
+
+    template<typename T>
+    static void prev_slices(vector<T*>& v_s)
+    {
+      for(auto& s : v_s)
+        s = s->prev_slice();
+    }
+
+  // Components of a box significantly tighter than the ones of a zonotope, the others
+  // being unbounded: each intersection with a strip breaks some correlations of
+  // the generators, and is then performed only if it is worth it
+
+    static IntervalVector tighter(const IntervalVector& x, const Zonotope& z)
+    {
+      const double ratio = 0.95;
+      IntervalVector x_(x);
+      const IntervalVector box = z.box();
+      for(int i = 0 ; i < x.size() ; i++)
+        if(!x[i].is_empty() && (box[i] & x[i]).diam() > ratio * box[i].diam())
+          x_[i] = Interval();
+      return x_;
+    }
+
+  // Input vector b as a n*1 matrix
+
+    static Matrix column(const Vector& b)
+    {
+      Matrix m(b.size(), 1);
+      for(int i = 0 ; i < b.size() ; i++)
+        m[i][0] = b[i];
+      return m;
+    }
+
+  CtcLinobsZonotope::CtcLinobsZonotope(const Matrix& A, const Matrix& B,
+    IntervalMatrix (*exp_At)(const Matrix& A, const Interval& t), int max_order)
+    : DynCtc(), m_A(A), m_B(B), m_exp_At(exp_At), m_max_generators((max_order-1) * A.nb_rows())
+  {
+    assert(A.nb_rows() == A.nb_cols());
+    assert(B.nb_rows() == A.nb_rows());
+    assert(max_order >= 1);
+  }
+
+  CtcLinobsZonotope::CtcLinobsZonotope(const Matrix& A, const Vector& b,
+    IntervalMatrix (*exp_At)(const Matrix& A, const Interval& t), int max_order)
+    : DynCtc(), m_A(A), m_B(column(b)), m_exp_At(exp_At), m_max_generators((max_order-1) * A.nb_rows())
+  {
+    assert(A.nb_rows() == A.nb_cols());
+    assert(b.size() == A.nb_rows());
+    assert(max_order >= 1);
+  }
+
+  void CtcLinobsZonotope::contract(vector<Domain*>& v_domains)
+  {
+    assert(v_domains.size() == 2);
+    assert(v_domains[0]->type() == Domain::Type::T_TUBE_VECTOR);
+
+    if(v_domains[1]->type() == Domain::Type::T_TUBE)
+      contract(v_domains[0]->tube_vector(), v_domains[1]->tube());
+
+    else if(v_domains[1]->type() == Domain::Type::T_TUBE_VECTOR)
+      contract(v_domains[0]->tube_vector(), v_domains[1]->tube_vector());
+
+    else
+      assert(false && "vector of domains not consistent with the contractor definition");
+  }
+
+  void CtcLinobsZonotope::contract(TubeVector& x, const TubeVector& u, TimePropag t_propa)
+  {
+    vector<double> v_t;
+    vector<IntervalVector> v_y;
+    contract(v_t, v_y, x, u, t_propa);
+  }
+
+  void CtcLinobsZonotope::contract(TubeVector& x, const Tube& u, TimePropag t_propa)
+  {
+    vector<double> v_t;
+    vector<IntervalVector> v_y;
+    contract(v_t, v_y, x, u, t_propa);
+  }
+
+  void CtcLinobsZonotope::contract(const vector<double>& v_t, vector<IntervalVector>& v_y, TubeVector& x, const TubeVector& u, TimePropag t_propa)
+  {
+    vector<const Tube*> v_u;
+    for(int i = 0 ; i < u.size() ; i++)
+      v_u.push_back(&u[i]);
+    ctc_slices(v_t, v_y, x, v_u, t_propa);
+  }
+
+  void CtcLinobsZonotope::contract(const vector<double>& v_t, vector<IntervalVector>& v_y, TubeVector& x, const Tube& u, TimePropag t_propa)
+  {
+    vector<const Tube*> v_u(1, &u);
+    ctc_slices(v_t, v_y, x, v_u, t_propa);
+  }
+
+  void CtcLinobsZonotope::ctc_slices(const vector<double>& v_t, vector<IntervalVector>& v_y, TubeVector& x, const vector<const Tube*>& v_u, TimePropag t_propa)
+  {
+    assert(x.size() == m_A.nb_rows());
+    assert((int)v_u.size() == m_B.nb_cols());
+    assert(v_t.size() == v_y.size());
+    for(const auto& u : v_u)
+      assert(TubeVector::same_slicing(x, *u));
+    for(size_t j = 0 ; j < v_t.size() ; j++)
+    {
+      assert(x.tdomain().contains(v_t[j]));
+      assert(v_y[j].size() == x.size());
+    }
+
+    if(x.is_empty())
+      return;
+
+    // Observations sorted by time: the ones of each slice
+    // are taken into account in chronological order
+
+    vector<size_t> v_obs(v_t.size());
+    iota(v_obs.begin(), v_obs.end(), 0);
+    sort(v_obs.begin(), v_obs.end(), [&v_t](size_t a, size_t b) { return v_t[a] < v_t[b]; });
+
+    vector<Slice*> v_sx(x.size());
+    vector<const Slice*> v_su(v_u.size());
+    Zonotope z(x.size());
+
+    // Forward contractions
+
+      if(t_propa & TimePropag::FORWARD)
+      {
+        for(int i = 0 ; i < x.size() ; i++)
+          v_sx[i] = x[i].first_slice();
+        for(size_t i = 0 ; i < v_u.size() ; i++)
+          v_su[i] = v_u[i]->first_slice();
+
+        z = Zonotope(input_gate(v_sx));
+        size_t j = 0;
+
+        while(v_sx[0] != NULL)
+        {
+          const Interval tkm1_tk = v_sx[0]->tdomain(); // [t_{k-1},t_k]
+          const bool last_slice = v_sx[0]->next_slice() == NULL;
+
+          if(!tkm1_tk.intersects(m_restricted_tdomain))
+          {
+            while(j < v_obs.size() && (v_t[v_obs[j]] < tkm1_tk.ub() || last_slice))
+              j++;
+            z = Zonotope(output_gate(v_sx));
+          }
+
+          else
+          {
+            const IntervalVector bu = m_B * codomain(v_su);
+            const Zonotope z_km1(z);
+            double t = tkm1_tk.lb();
+
+            for( ; j < v_obs.size() && (v_t[v_obs[j]] < tkm1_tk.ub() || last_slice) ; j++)
+            {
+              propagate(z, v_t[v_obs[j]] - t, bu, true);
+              z &= v_y[v_obs[j]];
+
+              v_y[v_obs[j]] &= z.box();
+              t = v_t[v_obs[j]];
+            }
+
+            propagate(z, tkm1_tk.ub() - t, bu, true);
+            z &= tighter(output_gate(v_sx), z);
+            z.reduce(m_max_generators);
+
+            if(z.is_empty())
+            {
+              x.set_empty();
+              return;
+            }
+
+            const IntervalVector outputgate_box = z.box();
+            for(int i = 0 ; i < x.size() ; i++)
+              v_sx[i]->set_output_gate(v_sx[i]->output_gate() & outputgate_box[i]);
+
+            if(t_propa & TimePropag::BACKWARD)
+            {
+              // The slice envelope will be computed during the backward process,
+              // from the contracted gates.
+            }
+
+            else
+            {
+              const IntervalVector envelope_box = envelope(z_km1, tkm1_tk.diam(), bu);
+              for(int i = 0 ; i < x.size() ; i++)
+                v_sx[i]->set_envelope(v_sx[i]->codomain() & envelope_box[i]);
+            }
+          }
+
+          next_slices(v_sx);
+          next_slices(v_su);
+        }
+      }
+
+    // Backward contractions
+
+      if(t_propa & TimePropag::BACKWARD)
+      {
+        for(int i = 0 ; i < x.size() ; i++)
+          v_sx[i] = x[i].last_slice();
+        for(size_t i = 0 ; i < v_u.size() ; i++)
+          v_su[i] = v_u[i]->last_slice();
+
+        if(!(t_propa & TimePropag::FORWARD))
+          z = Zonotope(output_gate(v_sx));
+        int j = (int)v_obs.size() - 1;
+
+        while(v_sx[0] != NULL)
+        {
+          const Interval tk_kp1 = v_sx[0]->tdomain(); // [t_k,t_{k+1}]
+          const bool first_slice = v_sx[0]->prev_slice() == NULL;
+
+          if(!tk_kp1.intersects(m_restricted_tdomain))
+          {
+            while(j >= 0 && (v_t[v_obs[j]] >= tk_kp1.lb() || first_slice))
+              j--;
+            z = Zonotope(input_gate(v_sx));
+          }
+
+          else
+          {
+            const IntervalVector bu = m_B * codomain(v_su);
+            double t = tk_kp1.ub();
+
+            for( ; j >= 0 && (v_t[v_obs[j]] >= tk_kp1.lb() || first_slice) ; j--)
+            {
+              propagate(z, t - v_t[v_obs[j]], bu, false);
+              z &= v_y[v_obs[j]];
+              v_y[v_obs[j]] &= z.box();
+              t = v_t[v_obs[j]];
+            }
+
+            propagate(z, t - tk_kp1.lb(), bu, false);
+            z &= tighter(input_gate(v_sx), z);
+            z.reduce(m_max_generators);
+
+            if(z.is_empty())
+            {
+              x.set_empty();
+              return;
+            }
+
+            const IntervalVector inputgate_box = z.box();
+            for(int i = 0 ; i < x.size() ; i++)
+              v_sx[i]->set_input_gate(v_sx[i]->input_gate() & inputgate_box[i]);
+
+            const IntervalVector envelope_box = envelope(z, tk_kp1.diam(), bu);
+            for(int i = 0 ; i < x.size() ; i++)
+              v_sx[i]->set_envelope(v_sx[i]->codomain() & envelope_box[i]);
+          }
+
+          prev_slices(v_sx);
+          prev_slices(v_su);
+        }
+      }
+  }
+
+  const CtcLinobsZonotope::ExpAt& CtcLinobsZonotope::exp_At(double dt, bool fwd)
+  {
+    map<double,ExpAt>& m_exp = fwd ? m_fwd_exp : m_bwd_exp;
+
+    auto it = m_exp.find(dt);
+    if(it != m_exp.end())
+      return it->second;
+
+    if(m_exp.size() >= EXP_CACHE_SIZE) // non-uniform slicing
+      m_exp.clear();
+
+    const Matrix A = fwd ? m_A : -m_A;
+    ExpAt e = { m_exp_At(A, Interval(dt)), m_exp_At(A, Interval(0.,dt)) };
+    return m_exp.insert(make_pair(dt, e)).first->second;
+  }
+
+  void CtcLinobsZonotope::propagate(Zonotope& z, double dt, const IntervalVector& bu, bool fwd)
+  {
+    assert(dt >= 0.);
+    if(dt == 0.)
+      return;
+
+    // x(t+dt) = e^{A.dt}x(t) + int_0^dt e^{A.s}Bu(t+dt-s)ds
+    const ExpAt& e = exp_At(dt, fwd);
+    z = e.e_dt * z + (fwd ? dt : -dt) * (e.e_0dt * bu);
+  }
+
+  const IntervalVector CtcLinobsZonotope::envelope(const Zonotope& z, double dt, const IntervalVector& bu)
+  {
+    if(dt == 0.)
+      return z.box();
+
+    const ExpAt& e = exp_At(dt, true);
+    return (e.e_0dt * z).box() + Interval(0.,dt) * (e.e_0dt * bu);
+  }
+}
@@ -0,0 +1,172 @@
+/** 
+ *  \file
+ *  CtcLinobsZonotope class
+ * ----------------------------------------------------------------------------
+ *  \date       2020
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2020 Simon Rohou
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#ifndef __TUBEX_CTCLINOBSZONOTOPE_H__
+#define __TUBEX_CTCLINOBSZONOTOPE_H__
+
+#include <map>
+#include <vector>
+#include "tubex_DynCtc.h"
+#include "tubex_Zonotope.h"
+
+namespace tubex
+{
+  /**
+   * \class CtcLinobsZonotope
+   * \brief \f$\mathcal{C}_\textrm{linobs}\f$ that contracts the tube \f$[\mathbf{x}](\cdot)\f$
+   *        with respect to the linear system \f$\dot{\mathbf{x}}=\mathbf{A}\mathbf{x}+\mathbf{B}\mathbf{u}\f$,
+   *        of any dimension, and to observations \f$\mathbf{x}(t_j)\in[\mathbf{y}_j]\f$
+   *
+   * Contrary to CtcLinobs, limited to two dimensions, the sets of feasible states are
+   * propagated as zonotopes. Their order is bounded at each step, so that the cost
+   * of a contraction is linear in the number of slices.
+   */
+  class CtcLinobsZonotope : public DynCtc
+  {
+    public:
+
+      /**
+       * \brief Creates a contractor object \f$\mathcal{C}_\textrm{linobs}\f$
+       *
+       * \param A the \f$n\times n\f$ state matrix
+       * \param B the \f$n\times m\f$ input matrix
+       * \param exp_At a function computing an enclosure of \f$e^{\mathbf{A}[t]}\f$
+       * \param max_order maximal order of the zonotopes (number of generators over \f$n\f$, 10 by default)
+       */
+      CtcLinobsZonotope(const ibex::Matrix& A, const ibex::Matrix& B,
+        ibex::IntervalMatrix (*exp_At)(const ibex::Matrix& A, const ibex::Interval& t), int max_order = 10);
+
+      /**
+       * \brief Creates a contractor object \f$\mathcal{C}_\textrm{linobs}\f$ for a scalar input
+       *
+       * \param A the \f$n\times n\f$ state matrix
+       * \param b the input vector of size \f$n\f$
+       * \param exp_At a function computing an enclosure of \f$e^{\mathbf{A}[t]}\f$
+       * \param max_order maximal order of the zonotopes (number of generators over \f$n\f$, 10 by default)
+       */
+      CtcLinobsZonotope(const ibex::Matrix& A, const ibex::Vector& b,
+        ibex::IntervalMatrix (*exp_At)(const ibex::Matrix& A, const ibex::Interval& t), int max_order = 10);
+
+      /*
+       * \brief Contracts a set of abstract domains
+       *
+       * This method makes the contractor available in the CN framework.
+       *
+       * \param v_domains vector of Domain pointers
+       */
+      void contract(std::vector<Domain*>& v_domains);
+
+      /**
+       * \brief \f$\mathcal{C}_\textrm{linobs}\big([\mathbf{x}](\cdot),[\mathbf{u}](\cdot)\big)\f$
+       *
+       * \param x the n-dimensional tube \f$[\mathbf{x}](\cdot)\f$ to be contracted
+       * \param u the m-dimensional input tube \f$[\mathbf{u}](\cdot)\f$
+       * \param t_propa temporal way of propagation
+       */
+      void contract(TubeVector& x, const TubeVector& u, TimePropag t_propa = TimePropag::FORWARD | TimePropag::BACKWARD);
+
+      /**
+       * \brief \f$\mathcal{C}_\textrm{linobs}\big([\mathbf{x}](\cdot),[u](\cdot)\big)\f$, for a scalar input
+       *
+       * \param x the n-dimensional tube \f$[\mathbf{x}](\cdot)\f$ to be contracted
+       * \param u the scalar input tube \f$[u](\cdot)\f$
+       * \param t_propa temporal way of propagation
+       */
+      void contract(TubeVector& x, const Tube& u, TimePropag t_propa = TimePropag::FORWARD | TimePropag::BACKWARD);
+
+      /**
+       * \brief \f$\mathcal{C}_\textrm{linobs}\big(\{[\mathbf{y}_j]\},[\mathbf{x}](\cdot),[\mathbf{u}](\cdot)\big)\f$
+       *
+       * \param v_t the observation times \f$t_j\f$
+       * \param v_y the observations \f$[\mathbf{y}_j]\f$, to be contracted
+       * \param x the n-dimensional tube \f$[\mathbf{x}](\cdot)\f$ to be contracted
+       * \param u the m-dimensional input tube \f$[\mathbf{u}](\cdot)\f$
+       * \param t_propa temporal way of propagation
+       */
+      void contract(const std::vector<double>& v_t, std::vector<ibex::IntervalVector>& v_y, TubeVector& x, const TubeVector& u, TimePropag t_propa = TimePropag::FORWARD | TimePropag::BACKWARD);
+
+      /**
+       * \brief \f$\mathcal{C}_\textrm{linobs}\big(\{[\mathbf{y}_j]\},[\mathbf{x}](\cdot),[u](\cdot)\big)\f$, for a scalar input
+       *
+       * \param v_t the observation times \f$t_j\f$
+       * \param v_y the observations \f$[\mathbf{y}_j]\f$, to be contracted
+       * \param x the n-dimensional tube \f$[\mathbf{x}](\cdot)\f$ to be contracted
+       * \param u the scalar input tube \f$[u](\cdot)\f$
+       * \param t_propa temporal way of propagation
+       */
+      void contract(const std::vector<double>& v_t, std::vector<ibex::IntervalVector>& v_y, TubeVector& x, const Tube& u, TimePropag t_propa = TimePropag::FORWARD | TimePropag::BACKWARD);
+
+    protected:
+
+      /**
+       * \brief Enclosures of \f$e^{\mathbf{A}\delta}\f$ and \f$e^{\mathbf{A}[0,\delta]}\f$
+       *        (or of \f$e^{-\mathbf{A}\delta}\f$ and \f$e^{-\mathbf{A}[0,\delta]}\f$)
+       */
+      struct ExpAt
+      {
+        ibex::IntervalMatrix e_dt; //!< \f$e^{\pm\mathbf{A}\delta}\f$
+        ibex::IntervalMatrix e_0dt; //!< \f$e^{\pm\mathbf{A}[0,\delta]}\f$
+      };
+
+      /**
+       * \brief Contractions along the slices of \f$[\mathbf{x}](\cdot)\f$
+       *
+       * \param v_t the observation times
+       * \param v_y the observations, to be contracted
+       * \param x the tube to be contracted
+       * \param v_u the components of the input tube
+       * \param t_propa temporal way of propagation
+       */
+      void ctc_slices(const std::vector<double>& v_t, std::vector<ibex::IntervalVector>& v_y, TubeVector& x, const std::vector<const Tube*>& v_u, TimePropag t_propa);
+
+      /**
+       * \brief Returns the enclosures of the matrix exponentials for a time step,
+       *        computed once for each time step
+       *
+       * \param dt the time step \f$\delta\f$
+       * \param fwd `true` for \f$e^{\mathbf{A}t}\f$, `false` for \f$e^{-\mathbf{A}t}\f$
+       * \return the enclosures of the matrix exponentials
+       */
+      const ExpAt& exp_At(double dt, bool fwd);
+
+      /**
+       * \brief Propagates a set of states over a time step
+       *
+       * \param z the zonotope to be propagated, from \f$t\f$ to \f$t\pm\delta\f$
+       * \param dt the time step \f$\delta\f$
+       * \param bu the enclosure of the input term \f$\mathbf{B}\mathbf{u}\f$ over the time step
+       * \param fwd `true` for a forward propagation, `false` for a backward one
+       */
+      void propagate(Zonotope& z, double dt, const ibex::IntervalVector& bu, bool fwd);
+
+      /**
+       * \brief Returns the envelope of the trajectories over a time step
+       *
+       * \param z the zonotope of the states at \f$t\f$
+       * \param dt the time step \f$\delta\f$
+       * \param bu the enclosure of the input term \f$\mathbf{B}\mathbf{u}\f$ over the time step
+       * \return the box enclosing the states over \f$[t,t+\delta]\f$
+       */
+      const ibex::IntervalVector envelope(const Zonotope& z, double dt, const ibex::IntervalVector& bu);
+
+    protected:
+
+      const ibex::Matrix m_A; //!< state matrix
+      const ibex::Matrix m_B; //!< input matrix
+      ibex::IntervalMatrix (*m_exp_At)(const ibex::Matrix& A, const ibex::Interval& t); //!< enclosure of \f$e^{\mathbf{A}[t]}\f$
+      const int m_max_generators; //!< maximal number of generators of the zonotopes, their center excepted
+      std::map<double,ExpAt> m_fwd_exp, m_bwd_exp; //!< exponentials already computed, by time step
+
+      static const size_t EXP_CACHE_SIZE = 64; //!< maximal number of time steps in the cache
+  };
+}
+
+#endif
@@ -9,6 +9,7 @@
  */
 
 #include "tubex_CtcStatic.h"
+#include "tubex_CtcFunction.h"
 
 using namespace std;
 using namespace ibex;
@@ -16,10 +17,24 @@ using namespace ibex;
 namespace tubex
 {
   CtcStatic::CtcStatic(Ctc& static_ctc, bool dynamic_ctc)
-    : DynCtc(false), m_static_ctc(static_ctc), m_dynamic_ctc(dynamic_ctc ? 1 : 0)
+    : DynCtc(false), m_static_ctc(static_ctc), m_dynamic_ctc(dynamic_ctc ? 1 : 0),
+      m_reentrant_ctc(typeid(static_ctc) == typeid(CtcFunction)), // a derived class may override contract()
+      m_mutex(make_shared<mutex>())
   {
 
   }
+
+  void CtcStatic::contract_box(IntervalVector& x)
+  {
+    if(m_reentrant_ctc) // CtcFunction: each thread works on its own copy
+      m_static_ctc.contract(x);
+
+    else
+    {
+      lock_guard<mutex> lock(*m_mutex);
+      m_static_ctc.contract(x);
+    }
+  }
   
   void CtcStatic::contract(vector<Domain*>& v_domains)
   {
@@ -50,9 +65,9 @@ namespace tubex
       outgate[i] = v_domains[i]->slice().output_gate();
     }
 
-    m_static_ctc.contract(envelope);
-    m_static_ctc.contract(ingate);
-    m_static_ctc.contract(outgate);
+    contract_box(envelope);
+    contract_box(ingate);
+    contract_box(outgate);
 
     for(int i = 0 ; i < n ; i++)
     {
@@ -193,8 +208,8 @@ namespace tubex
         ingate[i+m_dynamic_ctc] = v_x_slices[i]->input_gate();
       }
 
-      m_static_ctc.contract(envelope);
-      m_static_ctc.contract(ingate);
+      contract_box(envelope);
+      contract_box(ingate);
 
       for(int i = 0 ; i < n ; i++)
       {
@@ -212,7 +227,7 @@ namespace tubex
         for(int i = 0 ; i < n ; i++)
           outgate[i+m_dynamic_ctc] = v_x_slices[i]->output_gate();
 
-        m_static_ctc.contract(outgate);
+        contract_box(outgate);
 
         for(int i = 0 ; i < n ; i++)
           v_x_slices[i]->set_output_gate(outgate[i+m_dynamic_ctc]);
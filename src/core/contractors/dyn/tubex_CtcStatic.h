@@ -12,6 +12,8 @@
 #ifndef __TUBEX_CTCSTATIC_H__
 #define __TUBEX_CTCSTATIC_H__
 
+#include <mutex>
+#include <memory>
 #include "ibex_Ctc.h"
 #include "tubex_DynCtc.h"
 #include "tubex_Domain.h"
@@ -23,6 +25,10 @@ namespace tubex
    * \brief Generic static \f$\mathcal{C}\f$ that contracts a tube \f$[\mathbf{x}](\cdot)\f$ 
    *        with some IBEX contractor (for boxes).
    *        The contractor will be applied on each slice and gate.
+   *
+   * \note Contractions can be made from several threads. The calls to the
+   *       IBEX contractor are serialized, unless it is a thread-safe CtcFunction.
+   *       The copies of a CtcStatic share the same IBEX contractor, and the same lock.
    */
   class CtcStatic : public DynCtc
   {
@@ -122,8 +128,17 @@ namespace tubex
 
     protected:
 
+      /**
+       * \brief Applies the IBEX contractor on a box, in a thread-safe way
+       *
+       * \param x the box to be contracted
+       */
+      void contract_box(ibex::IntervalVector& x);
+
       ibex::Ctc& m_static_ctc; //!< related static contractor
       int m_dynamic_ctc; //!< specifies either the temporal tdomain is part of the contraction or not
+      bool m_reentrant_ctc; //!< if false, the calls to the static contractor are serialized
+      std::shared_ptr<std::mutex> m_mutex; //!< lock on the static contractor, shared by the copies
   };
 }
 
@@ -32,7 +32,7 @@ namespace tubex
     box.put(2, b);
     box[4] = d;
 
-    CtcFwdBwd::contract(box);
+    m_ctc_copies.get().CtcFwdBwd::contract(box); // copy of the calling thread
 
     a &= box.subvector(0,1);
     b &= box.subvector(2,3);
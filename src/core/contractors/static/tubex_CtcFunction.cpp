@@ -8,6 +8,7 @@
  *              the GNU Lesser General Public License (LGPL).
  */
 
+#include <deque>
 #include "tubex_CtcFunction.h"
 #include "ibex_CtcFwdBwd.h"
 
@@ -16,34 +17,72 @@ using namespace ibex;
 
 namespace tubex
 {
+  namespace
+  {
+    // Contraction of a variable to be propagated: its width
+    // is reduced by more than the ratio (as for ibex::CtcPropag)
+    bool significant_contraction(const Interval& x, const Interval& x_prev, float ratio)
+    {
+      if(x == x_prev)
+        return false;
+
+      if(x.is_empty() || x_prev.is_unbounded())
+        return true;
+
+      return x_prev.diam() - x.diam() > ratio * x_prev.diam();
+    }
+  }
+
   CtcFunction::CtcFunction(const Function& f)
-    : CtcFwdBwd(*new Function(f))
+    : CtcFunction(make_shared<const Function>(f))
   {
-    // todo: clean delete
+
   }
 
   CtcFunction::CtcFunction(const Function& f, const Domain& y)
-    : CtcFwdBwd(*new Function(f), y)
+    : CtcFunction(make_shared<const Function>(f), y)
   {
-    // todo: clean delete
+    // the sparsity pattern is not used with a generic ibex::Domain
   }
   
   CtcFunction::CtcFunction(const Function& f, const Interval& y)
-    : CtcFwdBwd(*new Function(f), y)
+    : CtcFunction(make_shared<const Function>(f), y)
   {
-    // todo: clean delete
+    m_v_y = vector<Interval>(1, y);
   }
 
   CtcFunction::CtcFunction(const Function& f, const IntervalVector& y)
-    : CtcFwdBwd(*new Function(f), y)
+    : CtcFunction(make_shared<const Function>(f), y)
+  {
+    for(int i = 0 ; i < y.size() ; i++)
+      m_v_y.push_back(y[i]);
+  }
+
+  CtcFunction::CtcFunction(const shared_ptr<const Function>& f)
+    : CtcFwdBwd(*f), m_f(f)
   {
-    // todo: clean delete
+    m_ctc_copies.reset(this, [this]() { return new CtcFunction(make_shared<const Function>(*m_f)); });
+    m_v_y = vector<Interval>(f->image_dim(), Interval(0.));
+  }
+
+  template<typename Y>
+  CtcFunction::CtcFunction(const shared_ptr<const Function>& f, const Y& y)
+    : CtcFwdBwd(*f, y), m_f(f)
+  {
+    // The copy of f is made from its expression, not from its workspace:
+    // it can be made while f is evaluated by another thread
+    m_ctc_copies.reset(this, [this, y]()
+      {
+        CtcFunction *ctc = new CtcFunction(make_shared<const Function>(*m_f), y);
+        ctc->m_v_y = m_v_y;
+        return ctc;
+      });
   }
 
   void CtcFunction::contract(IntervalVector& x)
   {
     assert(x.size() == nb_var);
-    CtcFwdBwd::contract(x);
+    m_ctc_copies.get().CtcFwdBwd::contract(x);
   }
 
   void CtcFunction::contract(TubeVector& x)
@@ -139,12 +178,25 @@ namespace tubex
     delete v_x_slices;
   }
 
+  void CtcFunction::set_sparse_mode(bool sparse)
+  {
+    m_sparse_mode = sparse;
+  }
+
+  void CtcFunction::set_fixedpoint_ratio(float r)
+  {
+    assert(Interval(0.,1).contains(r) && "invalid ratio");
+    m_fixedpoint_ratio = r;
+  }
+
   void CtcFunction::contract(Slice **v_x_slices)
   {
+    // Thread's own contractor, with its own memory of the last contractions
+    CtcFunction& ctc = m_ctc_copies.get();
     IntervalVector envelope(nb_var);
     IntervalVector ingate(nb_var);
 
-    while(v_x_slices[0] != NULL)
+    for(int k = 0 ; v_x_slices[0] != NULL ; k++)
     {
       for(int i = 0 ; i < nb_var ; i++)
       {
@@ -152,26 +204,45 @@ namespace tubex
         ingate[i] = v_x_slices[i]->input_gate();
       }
 
-      CtcFwdBwd::contract(envelope);
-      CtcFwdBwd::contract(ingate);
+      // In sparse mode, boxes unchanged since their last contraction are skipped
+      bool contracted_envelope = true, contracted_ingate = true;
+
+      if(m_sparse_mode)
+      {
+        contracted_envelope = ctc.contract_sparse(envelope, ctc.last_box(ctc.m_v_last_envelopes, k), m_fixedpoint_ratio);
+        contracted_ingate = ctc.contract_sparse(ingate, ctc.last_box(ctc.m_v_last_gates, k), m_fixedpoint_ratio);
+      }
+
+      else
+      {
+        ctc.CtcFwdBwd::contract(envelope);
+        ctc.CtcFwdBwd::contract(ingate);
+      }
 
       for(int i = 0 ; i < nb_var ; i++)
       {
-        v_x_slices[i]->set_envelope(envelope[i]);
-        v_x_slices[i]->set_input_gate(ingate[i]);
+        if(contracted_envelope)
+          v_x_slices[i]->set_envelope(envelope[i]);
+        if(contracted_ingate)
+          v_x_slices[i]->set_input_gate(ingate[i]);
       }
 
       if(v_x_slices[0]->next_slice() == NULL) // output gate
       {
         IntervalVector outgate(nb_var);
+        bool contracted_outgate = true;
 
         for(int i = 0 ; i < nb_var ; i++)
           outgate[i] = v_x_slices[i]->output_gate();
 
-        CtcFwdBwd::contract(outgate);
+        if(m_sparse_mode)
+          contracted_outgate = ctc.contract_sparse(outgate, ctc.last_box(ctc.m_v_last_gates, k+1), m_fixedpoint_ratio);
+        else
+          ctc.CtcFwdBwd::contract(outgate);
 
-        for(int i = 0 ; i < nb_var ; i++)
-          v_x_slices[i]->set_output_gate(outgate[i]);
+        if(contracted_outgate)
+          for(int i = 0 ; i < nb_var ; i++)
+            v_x_slices[i]->set_output_gate(outgate[i]);
 
         break; // end of contractions
       }
@@ -181,4 +252,95 @@ namespace tubex
           v_x_slices[i] = v_x_slices[i]->next_slice();
     }
   }
-}
\ No newline at end of file
+
+  IntervalVector& CtcFunction::last_box(vector<IntervalVector>& v_last, int k)
+  {
+    // Boxes not contracted yet are empty: never equal to a box to be contracted
+    while((int)v_last.size() <= k)
+      v_last.push_back(IntervalVector(nb_var, Interval::EMPTY_SET));
+    return v_last[k];
+  }
+
+  void CtcFunction::init_sparse_pattern()
+  {
+    m_v_vars_of_fi.clear();
+    m_v_fi_of_var = vector<vector<int> >(nb_var);
+
+    for(int i = 0 ; i < (int)m_v_y.size() ; i++)
+    {
+      const Function& fi = m_v_y.size() == 1 ? *m_f : (*m_f)[i];
+      m_v_fi.push_back(unique_ptr<Function>(new Function(fi)));
+      m_v_ctc_fi.push_back(unique_ptr<CtcFwdBwd>(new CtcFwdBwd(*m_v_fi.back(), m_v_y[i])));
+
+      m_v_vars_of_fi.push_back(vector<int>());
+      for(int j = 0 ; j < nb_var ; j++)
+        if(fi.used(j))
+        {
+          m_v_vars_of_fi[i].push_back(j);
+          m_v_fi_of_var[j].push_back(i);
+        }
+    }
+  }
+
+  bool CtcFunction::contract_sparse(IntervalVector& x, IntervalVector& x_last, float ratio)
+  {
+    if(x == x_last) // unchanged since its last contraction
+      return false;
+
+    if(m_v_y.empty()) // no sparsity pattern: full contraction
+    {
+      CtcFwdBwd::contract(x);
+      x_last = x;
+      return true;
+    }
+
+    if(m_v_ctc_fi.empty())
+      init_sparse_pattern();
+
+    // Components depending on the variables updated since the last contraction
+    deque<int> queue;
+    vector<bool> v_queued(m_v_ctc_fi.size(), false);
+
+    for(int j = 0 ; j < nb_var ; j++)
+      if(x[j] != x_last[j])
+        for(const auto& i : m_v_fi_of_var[j])
+          if(!v_queued[i])
+          {
+            v_queued[i] = true;
+            queue.push_back(i);
+          }
+
+    // Propagation: a variable significantly contracted (see significant_contraction())
+    // triggers the components depending on it
+    vector<Interval> v_prev;
+    while(!queue.empty() && !x.is_empty())
+    {
+      const int i = queue.front();
+      queue.pop_front();
+      v_queued[i] = false;
+
+      v_prev.clear();
+      for(const auto& j : m_v_vars_of_fi[i])
+        v_prev.push_back(x[j]);
+
+      m_v_ctc_fi[i]->contract(x);
+      if(x.is_empty())
+        break;
+
+      for(size_t k = 0 ; k < m_v_vars_of_fi[i].size() ; k++)
+      {
+        const int j = m_v_vars_of_fi[i][k];
+        if(significant_contraction(x[j], v_prev[k], ratio))
+          for(const auto& i2 : m_v_fi_of_var[j])
+            if(i2 != i && !v_queued[i2])
+            {
+              v_queued[i2] = true;
+              queue.push_back(i2);
+            }
+      }
+    }
+
+    x_last = x;
+    return true;
+  }
+}
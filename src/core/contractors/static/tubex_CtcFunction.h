@@ -13,10 +13,13 @@
 #define __TUBEX_CTCFUNCTION_H__
 
 #include <string>
+#include <vector>
+#include <memory>
 #include "ibex_Function.h"
 #include "ibex_CtcFwdBwd.h"
 #include "ibex_Domain.h"
 #include "tubex_TubeVector.h"
+#include "tubex_ThreadLocalCopies.h"
 
 namespace tubex
 {
@@ -25,6 +28,16 @@ namespace tubex
    * \brief Generic static \f$\mathcal{C}\f$ that contracts a box \f$[\mathbf{x}]\f$ or a tube \f$[\mathbf{x}](\cdot)\f$
    *        according to the constraint \f$\mathbf{f}(\mathbf{x})=\mathbf{0}\f$ or \f$\mathbf{f}(\mathbf{x})\in[\mathbf{y}]\f$.
    *        It stands on the CtcFwdBwd of IBEX (HC4Revise).
+   *
+   * \note The contractions are thread-safe: each thread works on its own copy
+   *       of the contractor, made at its first contraction. The first thread
+   *       evaluates the copy of \f$\mathbf{f}\f$ made by the constructor, the
+   *       other ones a copy of it, since the evaluations of an ibex::Function
+   *       are not re-entrant.
+   *
+   * \note A CtcFunction is not copyable, since it owns the contractors of the
+   *       threads: another contractor of the same constraint is built from
+   *       the same function instead.
    */
   class CtcFunction : public ibex::CtcFwdBwd
   {
@@ -63,6 +76,9 @@ namespace tubex
        * \param y the IntervalVector \f$[\mathbf{y}]\f$
        */
       CtcFunction(const ibex::Function& f, const ibex::IntervalVector& y);
+
+      CtcFunction(const CtcFunction&) = delete;
+      CtcFunction& operator=(const CtcFunction&) = delete;
       
       /**
        * \brief \f$\mathcal{C}\big([\mathbf{x}]\big)\f$
@@ -135,6 +151,34 @@ namespace tubex
        */
       void contract(Tube& x1, Tube& x2, Tube& x3, Tube& x4, Tube& x5, Tube& x6);
 
+      /**
+       * \brief Enables or disables the sparse mode for the contraction of tubes
+       *
+       * In sparse mode, the envelopes and gates that are unchanged since their last contraction
+       * are not contracted again. Otherwise, only the components of \f$\mathbf{f}\f$ that depend
+       * on the updated variables are contracted (with their own HC4Revise), and the contractions
+       * are propagated to the components sharing the contracted variables (see
+       * set_fixedpoint_ratio()). This is cheaper for
+       * large systems where each component involves few variables.
+       *
+       * \note The sparsity pattern is not available when \f$[\mathbf{y}]\f$ is given as an ibex::Domain:
+       *       only the unchanged boxes are then skipped.
+       *
+       * \param sparse if true, sparse mode enabled
+       */
+      void set_sparse_mode(bool sparse = true);
+
+      /**
+       * \brief Sets the ratio of contraction for the propagation between the components in sparse mode
+       *
+       * As for ibex::CtcPropag, the components depending on a contracted variable are contracted
+       * again only if the width of this variable has been reduced by more than this ratio.
+       * A ratio of 0 leads to a propagation until a fixed point.
+       *
+       * \param r ratio of contraction, \f$r\in[0,1]\f$ (0.1 by default)
+       */
+      void set_fixedpoint_ratio(float r);
+
       /**
        * \brief Contracts an array of slices (representing a slice vector)
        *
@@ -143,6 +187,64 @@ namespace tubex
        * \param v_x_slices the slices to be contracted
        */
       void contract(Slice **v_x_slices);
+
+    protected:
+
+      /**
+       * \brief Creates a contractor for the constraint \f$\mathbf{f}(\mathbf{x})=\mathbf{0}\f$,
+       *        evaluating a function that is not copied
+       *
+       * \param f the function \f$\mathbf{f}\f$, owned by this contractor
+       */
+      CtcFunction(const std::shared_ptr<const ibex::Function>& f);
+
+      /**
+       * \brief Creates a contractor for the constraint \f$\mathbf{f}(\mathbf{x})\in[\mathbf{y}]\f$,
+       *        evaluating a function that is not copied
+       *
+       * \param f the function \f$\mathbf{f}\f$, owned by this contractor
+       * \param y the image \f$[\mathbf{y}]\f$ (ibex::Domain, ibex::Interval or ibex::IntervalVector)
+       */
+      template<typename Y>
+      CtcFunction(const std::shared_ptr<const ibex::Function>& f, const Y& y);
+
+      /**
+       * \brief Returns the box of some envelope or gate, after its last contraction
+       *
+       * \param v_last the boxes of the envelopes or of the gates
+       * \param k the index of the envelope or gate
+       * \return a reference to the box, empty if not contracted yet
+       */
+      ibex::IntervalVector& last_box(std::vector<ibex::IntervalVector>& v_last, int k);
+
+      /**
+       * \brief Builds the contractors of the components of \f$\mathbf{f}\f$, and their sparsity pattern
+       */
+      void init_sparse_pattern();
+
+      /**
+       * \brief Contracts a box with the components of \f$\mathbf{f}\f$ depending on the variables
+       *        updated since its last contraction
+       *
+       * \param x the box to be contracted
+       * \param x_last the box after its last contraction, updated by this method
+       * \param ratio ratio of contraction for the propagation (see set_fixedpoint_ratio())
+       * \return false if the box is unchanged since its last contraction (nothing done)
+       */
+      bool contract_sparse(ibex::IntervalVector& x, ibex::IntervalVector& x_last, float ratio);
+
+      ThreadLocalCopies<CtcFunction> m_ctc_copies; //!< contractors of the threads, since HC4Revise is not re-entrant
+      std::shared_ptr<const ibex::Function> m_f; //!< copy of the function \f$\mathbf{f}\f$, evaluated by the base CtcFwdBwd
+      std::vector<ibex::Interval> m_v_y; //!< image of each component, empty if given as an ibex::Domain
+
+      bool m_sparse_mode = false; //!< if true, sparse mode enabled
+      float m_fixedpoint_ratio = 0.1; //!< ratio of contraction for the propagation in sparse mode
+      std::vector<std::unique_ptr<ibex::Function> > m_v_fi; //!< components of \f$\mathbf{f}\f$
+      std::vector<std::unique_ptr<ibex::CtcFwdBwd> > m_v_ctc_fi; //!< contractors of the components
+      std::vector<std::vector<int> > m_v_vars_of_fi; //!< variables used by each component
+      std::vector<std::vector<int> > m_v_fi_of_var; //!< components using each variable
+      std::vector<ibex::IntervalVector> m_v_last_envelopes; //!< envelopes after their last contraction
+      std::vector<ibex::IntervalVector> m_v_last_gates; //!< gates after their last contraction
   };
 }
 
@@ -557,6 +557,34 @@ namespace tubex
       return codomain_box()[0];
     }
 
+    const vector<Interval> Tube::tdomains() const
+    {
+      vector<Interval> v_tdomains;
+      v_tdomains.reserve(nb_slices());
+      for(const Slice *s = first_slice() ; s != NULL ; s = s->next_slice())
+        v_tdomains.push_back(s->tdomain());
+      return v_tdomains;
+    }
+
+    const vector<Interval> Tube::codomains() const
+    {
+      vector<Interval> v_codomains;
+      v_codomains.reserve(nb_slices());
+      for(const Slice *s = first_slice() ; s != NULL ; s = s->next_slice())
+        v_codomains.push_back(s->codomain());
+      return v_codomains;
+    }
+
+    const vector<Interval> Tube::gates() const
+    {
+      vector<Interval> v_gates;
+      v_gates.reserve(nb_slices() + 1);
+      for(const Slice *s = first_slice() ; s != NULL ; s = s->next_slice())
+        v_gates.push_back(s->input_gate());
+      v_gates.push_back(last_slice()->output_gate());
+      return v_gates;
+    }
+
     double Tube::volume() const
     {
       double volume = 0.;
@@ -676,40 +704,20 @@ namespace tubex
       if(m_synthesis_tree != NULL) // fast inversion
         return m_synthesis_tree->invert(y, search_tdomain);
 
-      Tube v(*this, Interval::ALL_REALS); // todo: optimize this
-      return invert(y, v, search_tdomain);
+      return invert_slices(y, NULL, NULL, search_tdomain);
     }
 
     void Tube::invert(const Interval& y, vector<Interval> &v_t, const Interval& search_tdomain) const
     {
-      // todo: fast inversion with binary tree considering derivative information
-      Tube v(*this, Interval::ALL_REALS); // todo: optimize this
       v_t.clear();
-      invert(y, v_t, v, search_tdomain);
+      invert_slices(y, &v_t, NULL, search_tdomain);
     }
 
     const Interval Tube::invert(const Interval& y, const Tube& v, const Interval& search_tdomain) const
     {
       assert(tdomain() == v.tdomain());
       assert(same_slicing(*this, v));
-
-      // todo: tree computations
-
-      Interval invert = Interval::EMPTY_SET;
-      Interval intersection = search_tdomain & tdomain();
-      if(intersection.is_empty())
-        return Interval::EMPTY_SET;
-
-      const Slice *s_x = slice(intersection.lb());
-      const Slice *s_v = v.slice(intersection.lb());
-      while(s_x != NULL && s_x->tdomain().lb() < intersection.ub())
-      {
-        invert |= s_x->invert(y, *s_v, intersection);
-        s_x = s_x->next_slice();
-        s_v = s_v->next_slice();
-      }
-
-      return invert;
+      return invert_slices(y, NULL, &v, search_tdomain);
     }
 
     void Tube::invert(const Interval& y, vector<Interval> &v_t, const Tube& v, const Interval& search_tdomain) const
@@ -717,34 +725,7 @@ namespace tubex
       assert(tdomain() == v.tdomain());
       assert(same_slicing(*this, v));
       v_t.clear();
-
-      // todo: tree computations
-
-      Interval invert = Interval::EMPTY_SET;
-      Interval intersection = search_tdomain & tdomain();
-      if(intersection.is_empty())
-        return;
-
-      const Slice *s_x = slice(intersection.lb());
-      const Slice *s_v = v.slice(intersection.lb());
-      while(s_x != NULL && s_x->tdomain().lb() <= intersection.ub())
-      {
-        Interval local_invert = s_x->invert(y, *s_v, intersection);
-        if(local_invert.is_empty() && !invert.is_empty())
-        {
-          v_t.push_back(invert);
-          invert.set_empty();
-        }
-
-        else
-          invert |= local_invert;
-
-        s_x = s_x->next_slice();
-        s_v = s_v->next_slice();
-      }
-
-      if(!invert.is_empty())
-        v_t.push_back(invert);
+      invert_slices(y, &v_t, &v, search_tdomain);
     }
 
     double Tube::max_diam() const
@@ -1395,4 +1376,78 @@ namespace tubex
         m_synthesis_tree = NULL;
       }
     }
+
+    const Interval Tube::invert_slices(const Interval& y, vector<Interval> *v_t, const Tube *v, const Interval& search_tdomain) const
+    {
+      Interval hull = Interval::EMPTY_SET, invert = Interval::EMPTY_SET;
+      Interval intersection = search_tdomain & tdomain();
+      if(intersection.is_empty())
+        return Interval::EMPTY_SET;
+
+      int k = time_to_index(intersection.lb());
+      const Slice *s_x = slice(k);
+      const Slice *s_v = (v == NULL) ? NULL : v->slice(k);
+      int k_v = k;
+
+      // With a synthesis tree, slices whose codomain does not intersect [y]
+      // (and so of empty inversion) are skipped without being visited
+      if(m_synthesis_tree != NULL)
+        s_x = m_synthesis_tree->next_slice_intersecting(y, k);
+
+      while(s_x != NULL && (s_x->tdomain().lb() < intersection.ub()
+                            || (v_t != NULL && s_x->tdomain().lb() == intersection.ub())))
+      {
+        Interval local_invert;
+
+        if(v == NULL)
+          local_invert = s_x->invert(y, intersection);
+
+        else
+        {
+          for( ; k_v < k ; k_v++) // derivative slice related to s_x
+            s_v = s_v->next_slice();
+          local_invert = s_x->invert(y, *s_v, intersection);
+        }
+
+        hull |= local_invert;
+
+        if(v_t != NULL)
+        {
+          if(local_invert.is_empty() && !invert.is_empty())
+          {
+            v_t->push_back(invert);
+            invert.set_empty();
+          }
+
+          else
+            invert |= local_invert;
+        }
+
+        if(m_synthesis_tree == NULL)
+        {
+          s_x = s_x->next_slice();
+          k++;
+        }
+
+        else
+        {
+          int next_k = k + 1;
+          s_x = m_synthesis_tree->next_slice_intersecting(y, next_k);
+
+          if(v_t != NULL && next_k != k + 1 && !invert.is_empty())
+          {
+            // Skipped slices end the current connected component
+            v_t->push_back(invert);
+            invert.set_empty();
+          }
+
+          k = next_k;
+        }
+      }
+
+      if(v_t != NULL && !invert.is_empty())
+        v_t->push_back(invert);
+
+      return hull;
+    }
 }
@@ -410,6 +410,27 @@ namespace tubex
        */
       const ibex::Interval codomain() const;
 
+      /**
+       * \brief Returns the temporal domains of the slices
+       *
+       * \return the \f$[t_i]\f$'s, in temporal order
+       */
+      const std::vector<ibex::Interval> tdomains() const;
+
+      /**
+       * \brief Returns the codomains (envelopes) of the slices
+       *
+       * \return the \f$[x_i]\f$'s related to the \f$[t_i]\f$'s
+       */
+      const std::vector<ibex::Interval> codomains() const;
+
+      /**
+       * \brief Returns the gates of this tube
+       *
+       * \return the input gates of the slices, then the output gate of the last one
+       */
+      const std::vector<ibex::Interval> gates() const;
+
       /**
        * \brief Returns the volume of this tube
        *
@@ -1143,6 +1164,21 @@ namespace tubex
        */
       void delete_synthesis_tree() const;
 
+      /**
+       * \brief Slice-wise inversion \f$[x]^{-1}([y])\f$, shared by the invert() methods
+       *
+       * \note No derivative tube is built when \f$[v](\cdot)\f$ is not provided.
+       *       When the synthesis tree is available, slices whose codomain does
+       *       not intersect \f$[y]\f$ are skipped without being visited.
+       *
+       * \param y the interval codomain
+       * \param v_t optional vector (may be NULL) in which the connected components are pushed
+       * \param v optional derivative tube (may be NULL)
+       * \param search_tdomain the temporal domain on which the inversion will be performed
+       * \return the hull of \f$[x]^{-1}([y])\f$
+       */
+      const ibex::Interval invert_slices(const ibex::Interval& y, std::vector<ibex::Interval> *v_t, const Tube *v, const ibex::Interval& search_tdomain) const;
+
       // Class variables:
 
         Slice *m_first_slice = NULL; //!< pointer to the first Slice object of this tube
@@ -133,6 +133,38 @@ namespace tubex
     }
   }
   
+  const Slice* TubeTreeSynthesis::next_slice_intersecting(const Interval& y, int& slice_id)
+  {
+    // Returns the first slice of index >= slice_id (relative to this subtree)
+    // whose codomain intersects [y], or NULL if none; slice_id is then
+    // updated to the index of the returned slice. Subtrees whose codomain
+    // does not intersect [y] are skipped at once.
+
+    if(slice_id >= m_nb_slices || !codomain().intersects(y))
+      return NULL;
+
+    if(is_leaf())
+    {
+      slice_id = 0;
+      return m_slice_ref;
+    }
+
+    int mid_id = m_first_subtree->nb_slices();
+
+    if(slice_id < mid_id)
+    {
+      const Slice *s = m_first_subtree->next_slice_intersecting(y, slice_id);
+      if(s != NULL)
+        return s;
+      slice_id = mid_id;
+    }
+
+    slice_id -= mid_id;
+    const Slice *s = m_second_subtree->next_slice_intersecting(y, slice_id);
+    slice_id += mid_id;
+    return s;
+  }
+  
   const Interval TubeTreeSynthesis::codomain()
   {
     if(m_values_update_needed)
@@ -316,7 +348,7 @@ namespace tubex
 
   void TubeTreeSynthesis::update_integrals()
   {
-    if(m_values_update_needed)
+    if(m_integrals_update_needed)
     {
       // 1. Updating leafs values (leaf nodes)
 
@@ -26,6 +26,7 @@ namespace tubex
       int nb_slices() const;
       const ibex::Interval operator()(const ibex::Interval& t);
       const ibex::Interval invert(const ibex::Interval& y, const ibex::Interval& search_tdomain);
+      const Slice* next_slice_intersecting(const ibex::Interval& y, int& slice_id);
       const ibex::Interval codomain();
       const std::pair<ibex::Interval,ibex::Interval> codomain_bounds();
       const std::pair<ibex::Interval,ibex::Interval> eval(const ibex::Interval& t = ibex::Interval::ALL_REALS);
@@ -310,6 +310,39 @@ namespace tubex
       return codomain_box();
     }
 
+    const vector<Interval> TubeVector::tdomains() const
+    {
+      assert(same_slicing(*this, (*this)[0]));
+      return (*this)[0].tdomains();
+    }
+
+    const vector<IntervalVector> TubeVector::codomains() const
+    {
+      assert(same_slicing(*this, (*this)[0]));
+      vector<IntervalVector> v_codomains(nb_slices(), IntervalVector(size()));
+      for(int i = 0 ; i < size() ; i++)
+      {
+        int k = 0;
+        for(const Slice *s = (*this)[i].first_slice() ; s != NULL ; s = s->next_slice())
+          v_codomains[k++][i] = s->codomain();
+      }
+      return v_codomains;
+    }
+
+    const vector<IntervalVector> TubeVector::gates() const
+    {
+      assert(same_slicing(*this, (*this)[0]));
+      vector<IntervalVector> v_gates(nb_slices() + 1, IntervalVector(size()));
+      for(int i = 0 ; i < size() ; i++)
+      {
+        int k = 0;
+        for(const Slice *s = (*this)[i].first_slice() ; s != NULL ; s = s->next_slice())
+          v_gates[k++][i] = s->input_gate();
+        v_gates[k][i] = (*this)[i].last_slice()->output_gate();
+      }
+      return v_gates;
+    }
+
     double TubeVector::volume() const
     {
       double vol = 0.;
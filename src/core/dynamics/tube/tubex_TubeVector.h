@@ -321,6 +321,33 @@ namespace tubex
        */
       const ibex::IntervalVector codomain() const;
 
+      /**
+       * \brief Returns the temporal domains of the slices
+       *
+       * \note The components must have the same slicing.
+       *
+       * \return the \f$[t_i]\f$'s, in temporal order
+       */
+      const std::vector<ibex::Interval> tdomains() const;
+
+      /**
+       * \brief Returns the codomains (envelopes) of the slices
+       *
+       * \note The components must have the same slicing.
+       *
+       * \return the \f$[\mathbf{x}_i]\f$'s related to the \f$[t_i]\f$'s
+       */
+      const std::vector<ibex::IntervalVector> codomains() const;
+
+      /**
+       * \brief Returns the gates of this tube
+       *
+       * \note The components must have the same slicing.
+       *
+       * \return the input gates of the slices, then the output gate of the last one
+       */
+      const std::vector<ibex::IntervalVector> gates() const;
+
       /**
        * \brief Returns the volume of this tube
        *
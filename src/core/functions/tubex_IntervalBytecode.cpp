@@ -0,0 +1,983 @@
+/** 
+ *  IntervalBytecode class
+ * ----------------------------------------------------------------------------
+ *  \date       2020
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2020 Simon Rohou
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#include <map>
+#include <algorithm>
+#include <tuple>
+#include <cmath>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include "tubex_IntervalBytecode.h"
+#include "tubex_Exception.h"
+
+#if __cplusplus >= 201703L && defined(__has_include)
+  #if __has_include(<charconv>)
+    #include <charconv>
+  #endif
+#endif
+
+#if !defined(__cpp_lib_to_chars) || __cpp_lib_to_chars < 201611L
+  #include <clocale>
+  #if defined(__APPLE__)
+    #include <xlocale.h>
+  #endif
+#endif
+
+using namespace std;
+using namespace ibex;
+
+namespace tubex
+{
+  // Parsing of a literal in the "C" locale: the expressions
+  // do not depend on the locale of the program (decimal point)
+
+    static double strtod_c(const string& str)
+    {
+      #if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+        double d = 0.;
+        from_chars(str.data(), str.data() + str.size(), d);
+        return d;
+      #elif defined(_WIN32)
+        static const _locale_t c_locale = _create_locale(LC_NUMERIC, "C");
+        return _strtod_l(str.c_str(), NULL, c_locale);
+      #else
+        static const locale_t c_locale = newlocale(LC_NUMERIC_MASK, "C", (locale_t)0);
+        return strtod_l(str.c_str(), NULL, c_locale);
+      #endif
+    }
+
+  // Enclosure of a decimal constant, degenerated if the constant is
+  // exactly representable: the parsed value may otherwise be rounded
+
+    static Interval decimal_constant(const string& str)
+    {
+      const double d = strtod_c(str);
+
+      // Mantissa and decimal exponent of the literal
+      long long m = 0;
+      int e = 0, nb_digits = 0;
+      bool frac = false, exact = true;
+      size_t i = 0;
+
+      for( ; i < str.size() && (isdigit(str[i]) || str[i] == '.') ; i++)
+      {
+        if(str[i] == '.')
+          frac = true;
+
+        else if(m != 0 || str[i] != '0')
+        {
+          if(++nb_digits > 18)
+            exact = false;
+          else
+          {
+            m = 10 * m + (str[i] - '0');
+            if(frac) e--;
+          }
+        }
+
+        else if(frac)
+          e--;
+      }
+
+      if(i < str.size()) // exponent
+        e += atoi(str.c_str() + i + 1);
+
+      const long long max_int = 9007199254740992LL; // 2^53
+
+      if(m != 0 && exact)
+      {
+        while(m % 10 == 0) { m /= 10; e++; }
+
+        if(e >= 0)
+          exact = e <= 22 && d <= max_int; // 10^e and the product exactly representable
+
+        else
+        {
+          // Exact iff 5^-e divides the mantissa: m.10^e = (m/5^-e).2^e
+          for(int k = 0 ; k < -e && exact ; k++)
+          {
+            exact = m % 5 == 0;
+            m /= 5;
+          }
+          exact &= m <= max_int;
+        }
+      }
+
+      if(exact)
+        return Interval(d);
+      return Interval(previous_float(d), next_float(d));
+    }
+
+  // Recursive-descent parser of the expressions, producing the instructions
+
+  class BytecodeParser
+  {
+    typedef IntervalBytecode::OpCode OpCode;
+
+    public:
+
+      BytecodeParser(IntervalBytecode& bc, int n, const char** x, const char* y)
+        : m_bc(bc), m_str(y), m_pos(0)
+      {
+        m_v_names.push_back("t");
+        for(int i = 0 ; i < n ; i++)
+        {
+          string name(x[i]);
+          for(size_t j = 0 ; j < name.size() ; j++)
+            if(!isalnum(name[j]) && name[j] != '_')
+              error("only scalar arguments are supported");
+          m_v_names.push_back(name);
+        }
+
+        m_bc.m_nb_inputs = n + 1;
+      }
+
+      void parse()
+      {
+        int r = parse_expr();
+        skip();
+        if(m_pos != m_str.size())
+          error("unexpected character");
+
+        if(r != VECTOR)
+          m_bc.m_v_outputs.push_back(r);
+        else
+          m_bc.m_v_outputs = m_v_vector;
+      }
+
+    protected:
+
+      static const int VECTOR = -1; // (f1;f2;...), only allowed as the whole expression
+
+      void error(const string& msg) const
+      {
+        throw Exception("IntervalBytecode", msg + " in \"" + m_str + "\"");
+      }
+
+      void skip()
+      {
+        while(m_pos < m_str.size() && isspace(m_str[m_pos]))
+          m_pos++;
+      }
+
+      char peek()
+      {
+        skip();
+        return m_pos < m_str.size() ? m_str[m_pos] : '\0';
+      }
+
+      void expect(char c)
+      {
+        if(peek() != c)
+          error(string("'") + c + "' expected");
+        m_pos++;
+      }
+
+      int scalar(int r) const
+      {
+        if(r == VECTOR)
+          error("vector of expressions in an operation");
+        return r;
+      }
+
+      int emit(OpCode op, int a, int b = 0, int p = 0)
+      {
+        if(op != OpCode::CST)
+        {
+          scalar(a);
+          if(op == OpCode::ADD || op == OpCode::SUB || op == OpCode::MUL || op == OpCode::DIV
+            || op == OpCode::POW || op == OpCode::MIN || op == OpCode::MAX || op == OpCode::ATAN2)
+            scalar(b);
+        }
+
+        // Common subexpressions evaluated only once
+        const auto key = make_tuple((int)op, a, b, p);
+        auto it = m_map_instr.find(key);
+        if(it != m_map_instr.end())
+          return it->second;
+
+        IntervalBytecode::Instruction instr = { op, a, b, p };
+        m_bc.m_v_instr.push_back(instr);
+        int r = m_bc.m_nb_inputs + (int)m_bc.m_v_instr.size() - 1;
+        m_map_instr[key] = r;
+        return r;
+      }
+
+      int constant(const Interval& x)
+      {
+        const auto key = make_pair(x.lb(), x.ub());
+        auto it = m_map_cst.find(key);
+        if(it != m_map_cst.end())
+          return emit(OpCode::CST, 0, 0, it->second);
+
+        m_bc.m_v_cst.push_back(x);
+        m_map_cst[key] = (int)m_bc.m_v_cst.size() - 1;
+        return emit(OpCode::CST, 0, 0, (int)m_bc.m_v_cst.size() - 1);
+      }
+
+      const Interval* constant_value(int r) const
+      {
+        int j = r - m_bc.m_nb_inputs;
+        if(j >= 0 && m_bc.m_v_instr[j].op == OpCode::CST)
+          return &m_bc.m_v_cst[m_bc.m_v_instr[j].p];
+        return NULL;
+      }
+
+      int power(int a, int b)
+      {
+        // Integer exponents evaluated as such, as ibex does
+        const Interval *e = constant_value(scalar(b));
+        if(e != NULL && e->is_degenerated() && e->lb() == floor(e->lb()) && fabs(e->lb()) < 1e9)
+          return e->lb() == 2. ? emit(OpCode::SQR, a) : emit(OpCode::POW_INT, a, 0, (int)e->lb());
+        return emit(OpCode::POW, a, b);
+      }
+
+      int parse_expr()
+      {
+        int r = parse_term();
+        while(true)
+        {
+          char c = peek();
+          if(c == '+') { m_pos++; r = emit(OpCode::ADD, r, parse_term()); }
+          else if(c == '-') { m_pos++; r = emit(OpCode::SUB, r, parse_term()); }
+          else return r;
+        }
+      }
+
+      int parse_term()
+      {
+        int r = parse_unary();
+        while(true)
+        {
+          char c = peek();
+          if(c == '*') { m_pos++; r = emit(OpCode::MUL, r, parse_unary()); }
+          else if(c == '/') { m_pos++; r = emit(OpCode::DIV, r, parse_unary()); }
+          else return r;
+        }
+      }
+
+      int parse_unary()
+      {
+        char c = peek();
+
+        if(c == '+')
+        {
+          m_pos++;
+          return parse_unary();
+        }
+
+        else if(c == '-')
+        {
+          m_pos++;
+          int r = parse_unary();
+          const Interval *x = constant_value(scalar(r));
+          return x != NULL ? constant(-*x) : emit(OpCode::MINUS, r);
+        }
+
+        int r = parse_primary();
+        if(peek() == '^')
+        {
+          m_pos++;
+          r = power(scalar(r), parse_unary());
+        }
+        return r;
+      }
+
+      string parse_number()
+      {
+        size_t begin = m_pos;
+        while(m_pos < m_str.size() && (isdigit(m_str[m_pos]) || m_str[m_pos] == '.'))
+          m_pos++;
+        if(m_pos < m_str.size() && (m_str[m_pos] == 'e' || m_str[m_pos] == 'E'))
+        {
+          m_pos++;
+          if(m_pos < m_str.size() && (m_str[m_pos] == '+' || m_str[m_pos] == '-'))
+            m_pos++;
+          while(m_pos < m_str.size() && isdigit(m_str[m_pos]))
+            m_pos++;
+        }
+
+        if(m_pos == begin)
+          error("number expected");
+        return m_str.substr(begin, m_pos - begin);
+      }
+
+      Interval parse_bound()
+      {
+        char c = peek();
+        bool neg = c == '-';
+        if(c == '-' || c == '+')
+          m_pos++;
+
+        skip();
+        if(m_str.compare(m_pos, 2, "oo") == 0)
+        {
+          m_pos += 2;
+          return Interval(neg ? NEG_INFINITY : POS_INFINITY);
+        }
+
+        Interval x = decimal_constant(parse_number());
+        return neg ? -x : x;
+      }
+
+      int parse_primary()
+      {
+        char c = peek();
+
+        if(isdigit(c) || c == '.')
+          return constant(decimal_constant(parse_number()));
+
+        else if(c == '[') // interval constant
+        {
+          m_pos++;
+          Interval lb = parse_bound();
+          expect(',');
+          Interval ub = parse_bound();
+          expect(']');
+          if(lb.lb() > ub.ub())
+            error("empty interval constant");
+          return constant(Interval(lb.lb(), ub.ub()));
+        }
+
+        else if(c == '(')
+        {
+          m_pos++;
+          vector<int> v_r(1, parse_expr());
+          while(peek() == ';')
+          {
+            m_pos++;
+            v_r.push_back(parse_expr());
+          }
+          expect(')');
+
+          if(v_r.size() == 1)
+            return v_r[0];
+
+          if(!m_v_vector.empty())
+            error("nested vectors are not supported");
+          for(const auto& r : v_r)
+            m_v_vector.push_back(scalar(r));
+          return VECTOR;
+        }
+
+        else if(isalpha(c) || c == '_')
+        {
+          size_t begin = m_pos;
+          while(m_pos < m_str.size() && (isalnum(m_str[m_pos]) || m_str[m_pos] == '_'))
+            m_pos++;
+          string name = m_str.substr(begin, m_pos - begin);
+
+          if(peek() != '(') // variable
+          {
+            for(size_t i = 0 ; i < m_v_names.size() ; i++)
+              if(m_v_names[i] == name)
+                return (int)i;
+            error("unknown symbol \"" + name + "\"");
+          }
+
+          m_pos++;
+          int a = parse_expr(), b = VECTOR;
+          if(peek() == ',')
+          {
+            m_pos++;
+            b = parse_expr();
+          }
+          expect(')');
+
+          static const map<string,OpCode> map_unary = {
+            { "sqr", OpCode::SQR }, { "sqrt", OpCode::SQRT }, { "exp", OpCode::EXP },
+            { "log", OpCode::LOG }, { "cos", OpCode::COS }, { "sin", OpCode::SIN },
+            { "tan", OpCode::TAN }, { "acos", OpCode::ACOS }, { "asin", OpCode::ASIN },
+            { "atan", OpCode::ATAN }, { "cosh", OpCode::COSH }, { "sinh", OpCode::SINH },
+            { "tanh", OpCode::TANH }, { "abs", OpCode::ABS }
+          };
+          static const map<string,OpCode> map_binary = {
+            { "min", OpCode::MIN }, { "max", OpCode::MAX }, { "atan2", OpCode::ATAN2 }
+          };
+
+          if(b == VECTOR && map_unary.find(name) != map_unary.end())
+            return emit(map_unary.at(name), a);
+          else if(b != VECTOR && map_binary.find(name) != map_binary.end())
+            return emit(map_binary.at(name), a, b);
+          else if(b != VECTOR && name == "pow")
+            return power(scalar(a), b);
+          error("unsupported function \"" + name + "\"");
+        }
+
+        error("unexpected character");
+        return VECTOR;
+      }
+
+    protected:
+
+      IntervalBytecode& m_bc;
+      const string m_str;
+      size_t m_pos;
+      vector<string> m_v_names;
+      vector<int> m_v_vector;
+      map<tuple<int,int,int,int>,int> m_map_instr;
+      map<pair<double,double>,int> m_map_cst;
+  };
+
+  // Symbolic differentiation of the instructions, producing the instructions of the gradient
+
+  class BytecodeDiff
+  {
+    typedef IntervalBytecode::OpCode OpCode;
+
+    public:
+
+      BytecodeDiff(const IntervalBytecode& f)
+        : m_bc(f)
+      {
+        // Instructions and constants of f are shared by the derivatives
+        for(size_t j = 0 ; j < m_bc.m_v_instr.size() ; j++)
+        {
+          const IntervalBytecode::Instruction& instr = m_bc.m_v_instr[j];
+          m_map_instr[make_tuple((int)instr.op, instr.a, instr.b, instr.p)] = m_bc.m_nb_inputs + (int)j;
+        }
+        for(size_t i = 0 ; i < m_bc.m_v_cst.size() ; i++)
+          m_map_cst[make_pair(m_bc.m_v_cst[i].lb(), m_bc.m_v_cst[i].ub())] = (int)i;
+      }
+
+      const IntervalBytecode diff()
+      {
+        if(m_bc.m_v_outputs.size() != 1)
+          throw Exception("IntervalBytecode::diff", "only scalar functions can be differentiated");
+
+        // Forward mode: derivatives of each register with respect to each input,
+        // as registers or as the constants ZERO and ONE (not emitted)
+
+        const int n = m_bc.m_nb_inputs;
+        const size_t nb_instr = m_bc.m_v_instr.size();
+        vector<int> v_d((n + nb_instr) * n, ZERO);
+        for(int i = 0 ; i < n ; i++)
+          v_d[i*n + i] = ONE;
+
+        for(size_t j = 0 ; j < nb_instr ; j++)
+        {
+          const IntervalBytecode::Instruction instr = m_bc.m_v_instr[j]; // copy: instructions are added
+          const int r = n + (int)j, a = instr.a, b = instr.b;
+
+          for(int k = 0 ; k < n ; k++)
+          {
+            const int da = instr.op == OpCode::CST ? ZERO : v_d[a*n + k];
+            const int db = is_binary(instr.op) ? v_d[b*n + k] : ZERO;
+            if(da == ZERO && db == ZERO)
+              continue;
+
+            int dr = ZERO;
+            switch(instr.op)
+            {
+              case OpCode::CST: break;
+              case OpCode::ADD: dr = add(da, db); break;
+              case OpCode::SUB: dr = sub(da, db); break;
+              case OpCode::MINUS: dr = minus(da); break;
+              case OpCode::MUL: dr = add(mul(da, b), mul(a, db)); break;
+              case OpCode::DIV: dr = div(sub(da, mul(r, db)), b); break;
+
+              case OpCode::POW:
+                if(da != ZERO) dr = mul(mul(b, emit(OpCode::POW, a, emit(OpCode::SUB, b, constant(1.)))), da);
+                if(db != ZERO) dr = add(dr, mul(mul(r, emit(OpCode::LOG, a)), db));
+                break;
+
+              case OpCode::ATAN2:
+                dr = div(sub(mul(b, da), mul(a, db)),
+                         emit(OpCode::ADD, emit(OpCode::SQR, a), emit(OpCode::SQR, b)));
+                break;
+
+              case OpCode::POW_INT:
+                if(instr.p == 0) break;
+                dr = mul(mul(constant(instr.p), instr.p == 1 ? ONE : instr.p == 2 ? a
+                                              : emit(OpCode::POW_INT, a, 0, instr.p - 1)), da);
+                break;
+
+              case OpCode::SQR: dr = mul(mul(constant(2.), a), da); break;
+              case OpCode::SQRT: dr = div(da, mul(constant(2.), r)); break;
+              case OpCode::EXP: dr = mul(r, da); break;
+              case OpCode::LOG: dr = div(da, a); break;
+              case OpCode::COS: dr = mul(minus(emit(OpCode::SIN, a)), da); break;
+              case OpCode::SIN: dr = mul(emit(OpCode::COS, a), da); break;
+              case OpCode::TAN: dr = mul(emit(OpCode::ADD, constant(1.), emit(OpCode::SQR, r)), da); break;
+              case OpCode::ACOS: dr = minus(div(da, sqrt_one_minus_sqr(a))); break;
+              case OpCode::ASIN: dr = div(da, sqrt_one_minus_sqr(a)); break;
+              case OpCode::ATAN: dr = div(da, emit(OpCode::ADD, constant(1.), emit(OpCode::SQR, a))); break;
+              case OpCode::COSH: dr = mul(emit(OpCode::SINH, a), da); break;
+              case OpCode::SINH: dr = mul(emit(OpCode::COSH, a), da); break;
+              case OpCode::TANH: dr = mul(emit(OpCode::SUB, constant(1.), emit(OpCode::SQR, r)), da); break;
+
+              case OpCode::MIN:
+              case OpCode::MAX:
+              case OpCode::ABS:
+                throw Exception("IntervalBytecode::diff", "operation not differentiable everywhere");
+            }
+
+            v_d[r*n + k] = dr;
+          }
+        }
+
+        const int f = m_bc.m_v_outputs[0];
+        m_bc.m_v_outputs.clear();
+        for(int k = 0 ; k < n ; k++)
+          m_bc.m_v_outputs.push_back(reg(v_d[f*n + k]));
+
+        remove_unused_instructions();
+        return m_bc;
+      }
+
+    protected:
+
+      static const int ZERO = -1, ONE = -2;
+
+      static bool is_binary(OpCode op)
+      {
+        return op == OpCode::ADD || op == OpCode::SUB || op == OpCode::MUL || op == OpCode::DIV
+          || op == OpCode::POW || op == OpCode::MIN || op == OpCode::MAX || op == OpCode::ATAN2;
+      }
+
+      int emit(OpCode op, int a, int b = 0, int p = 0)
+      {
+        const auto key = make_tuple((int)op, a, b, p);
+        auto it = m_map_instr.find(key);
+        if(it != m_map_instr.end())
+          return it->second;
+
+        IntervalBytecode::Instruction instr = { op, a, b, p };
+        m_bc.m_v_instr.push_back(instr);
+        int r = m_bc.m_nb_inputs + (int)m_bc.m_v_instr.size() - 1;
+        m_map_instr[key] = r;
+        return r;
+      }
+
+      int constant(double x)
+      {
+        const auto key = make_pair(x, x);
+        auto it = m_map_cst.find(key);
+        if(it == m_map_cst.end())
+        {
+          m_bc.m_v_cst.push_back(Interval(x));
+          it = m_map_cst.insert(make_pair(key, (int)m_bc.m_v_cst.size() - 1)).first;
+        }
+        return emit(OpCode::CST, 0, 0, it->second);
+      }
+
+      int reg(int a)
+      {
+        return a == ZERO ? constant(0.) : a == ONE ? constant(1.) : a;
+      }
+
+      int add(int a, int b)
+      {
+        if(a == ZERO) return b;
+        if(b == ZERO) return a;
+        return emit(OpCode::ADD, reg(a), reg(b));
+      }
+
+      int sub(int a, int b)
+      {
+        if(b == ZERO) return a;
+        if(a == ZERO) return minus(b);
+        return emit(OpCode::SUB, reg(a), reg(b));
+      }
+
+      int minus(int a)
+      {
+        return a == ZERO ? ZERO : a == ONE ? constant(-1.) : emit(OpCode::MINUS, a);
+      }
+
+      int mul(int a, int b)
+      {
+        if(a == ZERO || b == ZERO) return ZERO;
+        if(a == ONE) return b;
+        if(b == ONE) return a;
+        return emit(OpCode::MUL, a, b);
+      }
+
+      int div(int a, int b)
+      {
+        if(a == ZERO) return ZERO;
+        if(b == ONE) return a;
+        return emit(OpCode::DIV, reg(a), reg(b));
+      }
+
+      int sqrt_one_minus_sqr(int a)
+      {
+        return emit(OpCode::SQRT, emit(OpCode::SUB, constant(1.), emit(OpCode::SQR, a)));
+      }
+
+      void remove_unused_instructions()
+      {
+        // Registers needed by the outputs, from the last instruction to the first
+        const int n = m_bc.m_nb_inputs;
+        vector<bool> v_used(n + m_bc.m_v_instr.size(), false);
+        for(int r : m_bc.m_v_outputs)
+          v_used[r] = true;
+
+        for(int j = (int)m_bc.m_v_instr.size() - 1 ; j >= 0 ; j--)
+          if(v_used[n + j])
+          {
+            const IntervalBytecode::Instruction& instr = m_bc.m_v_instr[j];
+            if(instr.op != OpCode::CST)
+            {
+              v_used[instr.a] = true;
+              if(is_binary(instr.op))
+                v_used[instr.b] = true;
+            }
+          }
+
+        // Renumbering of the registers
+        vector<int> v_new_reg(v_used.size());
+        vector<IntervalBytecode::Instruction> v_instr;
+        for(int i = 0 ; i < n ; i++)
+          v_new_reg[i] = i;
+
+        for(size_t j = 0 ; j < m_bc.m_v_instr.size() ; j++)
+          if(v_used[n + j])
+          {
+            IntervalBytecode::Instruction instr = m_bc.m_v_instr[j];
+            if(instr.op != OpCode::CST)
+            {
+              instr.a = v_new_reg[instr.a];
+              if(is_binary(instr.op))
+                instr.b = v_new_reg[instr.b];
+            }
+            v_new_reg[n + j] = n + (int)v_instr.size();
+            v_instr.push_back(instr);
+          }
+
+        m_bc.m_v_instr = v_instr;
+        for(int& r : m_bc.m_v_outputs)
+          r = v_new_reg[r];
+      }
+
+      IntervalBytecode m_bc;
+      map<tuple<int,int,int,int>,int> m_map_instr;
+      map<pair<double,double>,int> m_map_cst;
+  };
+
+  const size_t IntervalBytecode::EVAL_CHUNK_SIZE;
+
+  IntervalBytecode::IntervalBytecode(int n, const char** x, const char* y)
+  {
+    assert(n >= 0);
+    assert(y != NULL);
+    BytecodeParser(*this, n, x, y).parse();
+  }
+
+  int IntervalBytecode::nb_inputs() const
+  {
+    return m_nb_inputs;
+  }
+
+  int IntervalBytecode::image_dim() const
+  {
+    return (int)m_v_outputs.size();
+  }
+
+  int IntervalBytecode::nb_instructions() const
+  {
+    return (int)m_v_instr.size();
+  }
+
+  const IntervalBytecode IntervalBytecode::operator[](int i) const
+  {
+    assert(i >= 0 && i < image_dim());
+    IntervalBytecode bc(*this);
+    bc.m_v_outputs = vector<int>(1, m_v_outputs[i]);
+    return bc;
+  }
+
+  const IntervalBytecode IntervalBytecode::diff() const
+  {
+    return BytecodeDiff(*this).diff();
+  }
+
+  const IntervalVector IntervalBytecode::eval_vector(const IntervalVector& x) const
+  {
+    IntervalVector y(image_dim());
+    eval_boxes(&x, 1, &y);
+    return y;
+  }
+
+  void IntervalBytecode::eval_vector(const vector<IntervalVector>& v_x, vector<IntervalVector>& v_y) const
+  {
+    v_y.resize(v_x.size(), IntervalVector(image_dim()));
+    if(!v_x.empty())
+      eval_boxes(&v_x[0], v_x.size(), &v_y[0]);
+  }
+
+  void IntervalBytecode::eval_boxes(const IntervalVector *x, size_t nb, IntervalVector *y) const
+  {
+    vector<Interval> v_reg;
+    for(size_t k = 0 ; k < nb ; k += EVAL_CHUNK_SIZE)
+      eval_chunk(x + k, min(EVAL_CHUNK_SIZE, nb - k), y + k, v_reg);
+  }
+
+  void IntervalBytecode::eval_chunk(const IntervalVector *x, size_t nb, IntervalVector *y, vector<Interval>& v_reg) const
+  {
+    assert(nb <= EVAL_CHUNK_SIZE);
+
+    // Registers stored by rows: the instructions are applied to all the boxes at once
+    v_reg.resize((m_nb_inputs + m_v_instr.size()) * nb);
+
+    for(size_t k = 0 ; k < nb ; k++)
+    {
+      assert(x[k].size() == m_nb_inputs);
+      for(int i = 0 ; i < m_nb_inputs ; i++)
+        v_reg[i*nb + k] = x[k][i];
+    }
+
+    #define TUBEX_BC_LOOP(expr) \
+      for(size_t k = 0 ; k < nb ; k++) r[k] = expr; \
+      break;
+
+    for(size_t j = 0 ; j < m_v_instr.size() ; j++)
+    {
+      const Instruction& instr = m_v_instr[j];
+      Interval *r = &v_reg[(m_nb_inputs + j) * nb];
+      const Interval *a = &v_reg[instr.a * nb], *b = &v_reg[instr.b * nb];
+
+      switch(instr.op)
+      {
+        case OpCode::CST: TUBEX_BC_LOOP(m_v_cst[instr.p])
+        case OpCode::ADD: TUBEX_BC_LOOP(a[k] + b[k])
+        case OpCode::SUB: TUBEX_BC_LOOP(a[k] - b[k])
+        case OpCode::MUL: TUBEX_BC_LOOP(a[k] * b[k])
+        case OpCode::DIV: TUBEX_BC_LOOP(a[k] / b[k])
+        case OpCode::MINUS: TUBEX_BC_LOOP(-a[k])
+        case OpCode::POW_INT: TUBEX_BC_LOOP(pow(a[k], instr.p))
+        case OpCode::POW: TUBEX_BC_LOOP(pow(a[k], b[k]))
+        case OpCode::MIN: TUBEX_BC_LOOP(min(a[k], b[k]))
+        case OpCode::MAX: TUBEX_BC_LOOP(max(a[k], b[k]))
+        case OpCode::ATAN2: TUBEX_BC_LOOP(atan2(a[k], b[k]))
+        case OpCode::SQR: TUBEX_BC_LOOP(sqr(a[k]))
+        case OpCode::SQRT: TUBEX_BC_LOOP(sqrt(a[k]))
+        case OpCode::EXP: TUBEX_BC_LOOP(exp(a[k]))
+        case OpCode::LOG: TUBEX_BC_LOOP(log(a[k]))
+        case OpCode::COS: TUBEX_BC_LOOP(cos(a[k]))
+        case OpCode::SIN: TUBEX_BC_LOOP(sin(a[k]))
+        case OpCode::TAN: TUBEX_BC_LOOP(tan(a[k]))
+        case OpCode::ACOS: TUBEX_BC_LOOP(acos(a[k]))
+        case OpCode::ASIN: TUBEX_BC_LOOP(asin(a[k]))
+        case OpCode::ATAN: TUBEX_BC_LOOP(atan(a[k]))
+        case OpCode::COSH: TUBEX_BC_LOOP(cosh(a[k]))
+        case OpCode::SINH: TUBEX_BC_LOOP(sinh(a[k]))
+        case OpCode::TANH: TUBEX_BC_LOOP(tanh(a[k]))
+        case OpCode::ABS: TUBEX_BC_LOOP(abs(a[k]))
+      }
+    }
+
+    #undef TUBEX_BC_LOOP
+
+    for(size_t k = 0 ; k < nb ; k++)
+    {
+      assert(y[k].size() == image_dim());
+
+      if(x[k].is_empty()) // as for ibex functions
+        y[k].set_empty();
+
+      else
+        for(size_t i = 0 ; i < m_v_outputs.size() ; i++)
+          y[k][i] = v_reg[m_v_outputs[i] * nb + k];
+    }
+  }
+
+  const IntervalMatrix IntervalBytecode::eval_jacobian(const IntervalVector& x) const
+  {
+    IntervalVector y(image_dim()), y_c(image_dim());
+    IntervalMatrix d(image_dim(), m_nb_inputs);
+    eval_first_order(x, x.mid(), false, y, y_c, d);
+    return d;
+  }
+
+  const IntervalVector IntervalBytecode::eval_mean_value(const IntervalVector& x) const
+  {
+    return eval_first_order_form(x, false);
+  }
+
+  const IntervalVector IntervalBytecode::eval_centered(const IntervalVector& x) const
+  {
+    return eval_first_order_form(x, true);
+  }
+
+  const IntervalVector IntervalBytecode::eval_first_order_form(const IntervalVector& x, bool slopes) const
+  {
+    assert(x.size() == m_nb_inputs);
+
+    if(x.is_empty() || x.is_unbounded())
+      return eval_vector(x);
+
+    const Vector c = x.mid();
+    IntervalVector y(image_dim()), y_c(image_dim());
+    IntervalMatrix d(image_dim(), m_nb_inputs);
+    eval_first_order(x, c, slopes, y, y_c, d);
+
+    IntervalVector dx = x - c;
+    for(int i = 0 ; i < image_dim() ; i++)
+    {
+      // f(c) is not defined if c is outside the domain of f: natural evaluation only
+      if(y_c[i].is_empty())
+        continue;
+
+      Interval y_i = y_c[i];
+      for(int k = 0 ; k < m_nb_inputs ; k++)
+        y_i += d[i][k] * dx[k];
+      y[i] &= y_i;
+    }
+
+    return y;
+  }
+
+  void IntervalBytecode::eval_first_order(const IntervalVector& x, const Vector& c, bool slopes,
+                                          IntervalVector& y, IntervalVector& y_c, IntervalMatrix& d) const
+  {
+    assert(x.size() == m_nb_inputs && c.size() == m_nb_inputs);
+    assert(y.size() == image_dim() && y_c.size() == image_dim());
+    assert(d.nb_rows() == image_dim() && d.nb_cols() == m_nb_inputs);
+
+    // For each register: value over [x], value at c, and a row of
+    // derivatives (or slopes) with respect to the n inputs
+
+    const int n = m_nb_inputs;
+    const size_t nb_reg = n + m_v_instr.size();
+    vector<Interval> v_x(nb_reg), v_c(nb_reg), v_d(nb_reg * n, Interval(0.));
+
+    for(int i = 0 ; i < n ; i++)
+    {
+      v_x[i] = x[i];
+      v_c[i] = c[i];
+      v_d[i*n + i] = 1.;
+    }
+
+    for(size_t j = 0 ; j < m_v_instr.size() ; j++)
+    {
+      const Instruction& instr = m_v_instr[j];
+      const size_t r = n + j;
+      const Interval &xa = v_x[instr.a], &xb = v_x[instr.b], &ca = v_c[instr.a], &cb = v_c[instr.b];
+      const Interval *da = &v_d[instr.a * n], *db = &v_d[instr.b * n];
+      Interval *dr = &v_d[r * n];
+
+      // Value over [x] and at c
+      switch(instr.op)
+      {
+        case OpCode::CST: v_x[r] = v_c[r] = m_v_cst[instr.p]; break;
+        case OpCode::ADD: v_x[r] = xa + xb; v_c[r] = ca + cb; break;
+        case OpCode::SUB: v_x[r] = xa - xb; v_c[r] = ca - cb; break;
+        case OpCode::MUL: v_x[r] = xa * xb; v_c[r] = ca * cb; break;
+        case OpCode::DIV: v_x[r] = xa / xb; v_c[r] = ca / cb; break;
+        case OpCode::MINUS: v_x[r] = -xa; v_c[r] = -ca; break;
+        case OpCode::POW_INT: v_x[r] = pow(xa, instr.p); v_c[r] = pow(ca, instr.p); break;
+        case OpCode::POW: v_x[r] = pow(xa, xb); v_c[r] = pow(ca, cb); break;
+        case OpCode::MIN: v_x[r] = min(xa, xb); v_c[r] = min(ca, cb); break;
+        case OpCode::MAX: v_x[r] = max(xa, xb); v_c[r] = max(ca, cb); break;
+        case OpCode::ATAN2: v_x[r] = atan2(xa, xb); v_c[r] = atan2(ca, cb); break;
+        case OpCode::SQR: v_x[r] = sqr(xa); v_c[r] = sqr(ca); break;
+        case OpCode::SQRT: v_x[r] = sqrt(xa); v_c[r] = sqrt(ca); break;
+        case OpCode::EXP: v_x[r] = exp(xa); v_c[r] = exp(ca); break;
+        case OpCode::LOG: v_x[r] = log(xa); v_c[r] = log(ca); break;
+        case OpCode::COS: v_x[r] = cos(xa); v_c[r] = cos(ca); break;
+        case OpCode::SIN: v_x[r] = sin(xa); v_c[r] = sin(ca); break;
+        case OpCode::TAN: v_x[r] = tan(xa); v_c[r] = tan(ca); break;
+        case OpCode::ACOS: v_x[r] = acos(xa); v_c[r] = acos(ca); break;
+        case OpCode::ASIN: v_x[r] = asin(xa); v_c[r] = asin(ca); break;
+        case OpCode::ATAN: v_x[r] = atan(xa); v_c[r] = atan(ca); break;
+        case OpCode::COSH: v_x[r] = cosh(xa); v_c[r] = cosh(ca); break;
+        case OpCode::SINH: v_x[r] = sinh(xa); v_c[r] = sinh(ca); break;
+        case OpCode::TANH: v_x[r] = tanh(xa); v_c[r] = tanh(ca); break;
+        case OpCode::ABS: v_x[r] = abs(xa); v_c[r] = abs(ca); break;
+      }
+
+      const Interval& xr = v_x[r];
+
+      // Derivatives (or slopes), by the chain rule: for elementary functions,
+      // the derivative over [x] also encloses the slope (mean value theorem)
+
+      Interval df; // derivative of a unary operation
+      switch(instr.op)
+      {
+        case OpCode::CST:
+          continue;
+
+        case OpCode::ADD:
+          for(int k = 0 ; k < n ; k++) dr[k] = da[k] + db[k];
+          continue;
+
+        case OpCode::SUB:
+          for(int k = 0 ; k < n ; k++) dr[k] = da[k] - db[k];
+          continue;
+
+        case OpCode::MINUS:
+          for(int k = 0 ; k < n ; k++) dr[k] = -da[k];
+          continue;
+
+        case OpCode::MUL:
+          // slope: a(x)b(x)-a(c)b(c) = (a(x)-a(c))b(x) + a(c)(b(x)-b(c))
+          for(int k = 0 ; k < n ; k++) dr[k] = da[k] * xb + (slopes ? ca : xa) * db[k];
+          continue;
+
+        case OpCode::DIV:
+        {
+          const Interval q = slopes ? v_c[r] : xr;
+          for(int k = 0 ; k < n ; k++) dr[k] = (da[k] - q * db[k]) / xb;
+          continue;
+        }
+
+        case OpCode::MIN:
+        case OpCode::MAX:
+          // the variation of min/max lies between the variations of the operands
+          for(int k = 0 ; k < n ; k++) dr[k] = da[k] | db[k];
+          continue;
+
+        case OpCode::POW:
+        {
+          const Interval d_a = xb * pow(xa, xb - 1.), d_b = xr * log(xa);
+          for(int k = 0 ; k < n ; k++) dr[k] = d_a * da[k] + d_b * db[k];
+          continue;
+        }
+
+        case OpCode::ATAN2:
+        {
+          const Interval den = sqr(xa) + sqr(xb);
+          for(int k = 0 ; k < n ; k++) dr[k] = (xb * da[k] - xa * db[k]) / den;
+          continue;
+        }
+
+        case OpCode::SQR: df = slopes ? xa + ca : 2. * xa; break;
+        case OpCode::POW_INT: df = instr.p == 0 ? Interval(0.) : instr.p * pow(xa, instr.p - 1); break;
+        case OpCode::SQRT: df = 0.5 / xr; break;
+        case OpCode::EXP: df = xr; break;
+        case OpCode::LOG: df = 1. / xa; break;
+        case OpCode::COS: df = -sin(xa); break;
+        case OpCode::SIN: df = cos(xa); break;
+        case OpCode::TAN: df = 1. + sqr(xr); break;
+        case OpCode::ACOS: df = -1. / sqrt(1. - sqr(xa)); break;
+        case OpCode::ASIN: df = 1. / sqrt(1. - sqr(xa)); break;
+        case OpCode::ATAN: df = 1. / (1. + sqr(xa)); break;
+        case OpCode::COSH: df = sinh(xa); break;
+        case OpCode::SINH: df = cosh(xa); break;
+        case OpCode::TANH: df = 1. - sqr(xr); break;
+        case OpCode::ABS: df = sign(xa); break;
+      }
+
+      for(int k = 0 ; k < n ; k++)
+        dr[k] = df * da[k];
+    }
+
+    for(size_t i = 0 ; i < m_v_outputs.size() ; i++)
+    {
+      const int r = m_v_outputs[i];
+      y[i] = v_x[r];
+      y_c[i] = v_c[r];
+      for(int k = 0 ; k < n ; k++)
+        d[i][k] = v_d[r*n + k];
+    }
+  }
+}
@@ -0,0 +1,226 @@
+/** 
+ *  \file
+ *  IntervalBytecode class
+ * ----------------------------------------------------------------------------
+ *  \date       2020
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2020 Simon Rohou
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#ifndef __TUBEX_INTERVALBYTECODE_H__
+#define __TUBEX_INTERVALBYTECODE_H__
+
+#include <vector>
+#include "ibex_Interval.h"
+#include "ibex_Vector.h"
+#include "ibex_IntervalVector.h"
+#include "ibex_IntervalMatrix.h"
+
+namespace tubex
+{
+  /**
+   * \class IntervalBytecode
+   * \brief Compiled form of an analytic expression \f$\mathbf{f}(t,x_1,\dots,x_n)\f$,
+   *        as a flat sequence of interval instructions
+   *
+   * The expression is parsed once. Each instruction writes its result in its own
+   * register, and common subexpressions are evaluated only once. A set of boxes is
+   * evaluated in a single pass over the instructions, so that the cost of the
+   * interpretation is shared among the boxes (for instance the slices of a tube).
+   *
+   * The outward rounding is the one of the interval operations. Decimal constants
+   * that are not exactly representable are enclosed by their two neighbouring floats.
+   *
+   * First-order evaluations are also provided, by forward-mode differentiation
+   * of the same instructions: Jacobian matrix, mean-value and centered forms.
+   *
+   * The syntax is the one of ibex for scalar arguments: `+ - * / ^`, the usual
+   * elementary functions, interval constants `[a,b]` and a vector of outputs `(f1;f2;...)`.
+   * An Exception is raised for any other expression.
+   */
+  class IntervalBytecode
+  {
+    public:
+
+      /**
+       * \brief Compiles the expression \f$\mathbf{f}(t,x_1,\dots,x_n)\f$
+       *
+       * \param n the number of scalar arguments, \f$t\f$ excepted
+       * \param x the names of the arguments
+       * \param y the expression of \f$\mathbf{f}\f$
+       */
+      IntervalBytecode(int n, const char** x, const char* y);
+
+      /**
+       * \brief Returns the number of inputs, \f$t\f$ included
+       *
+       * \return the size of the evaluated boxes
+       */
+      int nb_inputs() const;
+
+      /**
+       * \brief Returns the dimension of the image of \f$\mathbf{f}\f$
+       *
+       * \return the number of outputs
+       */
+      int image_dim() const;
+
+      /**
+       * \brief Returns the number of instructions of the compiled expression
+       *
+       * \return the number of instructions, constants included
+       */
+      int nb_instructions() const;
+
+      /**
+       * \brief Returns the compiled form of the i-th component of \f$\mathbf{f}\f$
+       *
+       * \param i the index of the component
+       * \return the bytecode of \f$f_i\f$
+       */
+      const IntervalBytecode operator[](int i) const;
+
+      /**
+       * \brief Evaluates \f$\mathbf{f}\f$ over a box
+       *
+       * \param x the box \f$([t],[x_1],\dots,[x_n])\f$
+       * \return the enclosure of \f$\mathbf{f}([t],[\mathbf{x}])\f$
+       */
+      const ibex::IntervalVector eval_vector(const ibex::IntervalVector& x) const;
+
+      /**
+       * \brief Evaluates \f$\mathbf{f}\f$ over a set of boxes, in a single pass
+       *
+       * \param v_x the boxes \f$([t],[x_1],\dots,[x_n])\f$
+       * \param v_y the enclosures of \f$\mathbf{f}\f$ over each box
+       */
+      void eval_vector(const std::vector<ibex::IntervalVector>& v_x, std::vector<ibex::IntervalVector>& v_y) const;
+
+      /**
+       * \brief Evaluates \f$\mathbf{f}\f$ over an array of boxes
+       *
+       * The boxes are evaluated by chunks of EVAL_CHUNK_SIZE boxes, in a single pass
+       * over the instructions for each chunk: the memory used by the registers
+       * does not depend on the number of boxes.
+       *
+       * \param x pointer to the first box
+       * \param nb the number of boxes
+       * \param y pointer to the first result, already allocated
+       */
+      void eval_boxes(const ibex::IntervalVector *x, size_t nb, ibex::IntervalVector *y) const;
+
+      /**
+       * \brief Returns the compiled form of the derivatives of a scalar function \f$f\f$
+       *
+       * The outputs are the partial derivatives \f$(\frac{\partial f}{\partial t},
+       * \frac{\partial f}{\partial x_1},\dots,\frac{\partial f}{\partial x_n})\f$, as for
+       * the derivative of an ibex function. An Exception is raised if the expression
+       * involves operations that are not differentiable everywhere (`abs`, `min`, `max`).
+       *
+       * \return the bytecode of the gradient of \f$f\f$
+       */
+      const IntervalBytecode diff() const;
+
+      static const size_t EVAL_CHUNK_SIZE = 1024; //!< maximal number of boxes evaluated in a single pass
+
+      /**
+       * \brief Evaluates the Jacobian matrix of \f$\mathbf{f}\f$ over a box, by forward-mode differentiation
+       *
+       * \param x the box \f$([t],[x_1],\dots,[x_n])\f$
+       * \return the enclosure of the derivatives of \f$\mathbf{f}\f$ with respect to \f$(t,x_1,\dots,x_n)\f$
+       */
+      const ibex::IntervalMatrix eval_jacobian(const ibex::IntervalVector& x) const;
+
+      /**
+       * \brief Evaluates \f$\mathbf{f}\f$ over a box with the mean-value form
+       *
+       * The enclosure \f$\mathbf{f}(\mathbf{m})+\mathbf{J}_{\mathbf{f}}([\mathbf{x}])\cdot([\mathbf{x}]-\mathbf{m})\f$,
+       * where \f$\mathbf{m}\f$ is the midpoint of \f$[\mathbf{x}]\f$, is intersected with the natural evaluation.
+       * It is tighter on wide boxes, since its overestimation is quadratic in the width of the box.
+       *
+       * \param x the box \f$([t],[x_1],\dots,[x_n])\f$
+       * \return the enclosure of \f$\mathbf{f}([t],[\mathbf{x}])\f$
+       */
+      const ibex::IntervalVector eval_mean_value(const ibex::IntervalVector& x) const;
+
+      /**
+       * \brief Evaluates \f$\mathbf{f}\f$ over a box with the centered form, computed with slopes
+       *
+       * Same as eval_mean_value(), with the Jacobian matrix replaced by slopes around \f$\mathbf{m}\f$,
+       * that are included in the derivatives (for instance, the slope of \f$x^2\f$ is \f$[x]+m\f$
+       * instead of \f$2[x]\f$).
+       *
+       * \param x the box \f$([t],[x_1],\dots,[x_n])\f$
+       * \return the enclosure of \f$\mathbf{f}([t],[\mathbf{x}])\f$
+       */
+      const ibex::IntervalVector eval_centered(const ibex::IntervalVector& x) const;
+
+    protected:
+
+      /**
+       * \enum OpCode
+       * \brief Interval operations of the instructions
+       */
+      enum class OpCode
+      {
+        CST, ADD, SUB, MUL, DIV, MINUS, POW_INT, POW, MIN, MAX, ATAN2,
+        SQR, SQRT, EXP, LOG, COS, SIN, TAN, ACOS, ASIN, ATAN, COSH, SINH, TANH, ABS
+      };
+
+      /**
+       * \struct Instruction
+       * \brief Instruction writing in the register of index nb_inputs()+(its index)
+       */
+      struct Instruction
+      {
+        OpCode op; //!< operation
+        int a, b; //!< registers of the operands (b unused for unary operations)
+        int p; //!< integer exponent, or index of the constant
+      };
+
+      /**
+       * \brief Evaluates \f$\mathbf{f}\f$ and its first-order terms over a box, in a single pass
+       *
+       * \param x the box \f$[\mathbf{x}]\f$
+       * \param c a point of \f$[\mathbf{x}]\f$
+       * \param slopes if true, slopes around \f$\mathbf{c}\f$ are computed instead of derivatives
+       * \param y the natural evaluation over \f$[\mathbf{x}]\f$
+       * \param y_c the evaluation at \f$\mathbf{c}\f$
+       * \param d the derivatives (or slopes), one row per output
+       */
+      void eval_first_order(const ibex::IntervalVector& x, const ibex::Vector& c, bool slopes,
+                            ibex::IntervalVector& y, ibex::IntervalVector& y_c, ibex::IntervalMatrix& d) const;
+
+      /**
+       * \brief Evaluates the centered form of \f$\mathbf{f}\f$ at the midpoint of a box
+       *
+       * \param x the box \f$[\mathbf{x}]\f$
+       * \param slopes if true, slopes are used instead of derivatives
+       * \return the enclosure of \f$\mathbf{f}([\mathbf{x}])\f$
+       */
+      const ibex::IntervalVector eval_first_order_form(const ibex::IntervalVector& x, bool slopes) const;
+
+      /**
+       * \brief Evaluates \f$\mathbf{f}\f$ over at most EVAL_CHUNK_SIZE boxes, in a single pass
+       *
+       * \param x pointer to the first box
+       * \param nb the number of boxes
+       * \param y pointer to the first result, already allocated
+       * \param v_reg registers, reused from one chunk to the next
+       */
+      void eval_chunk(const ibex::IntervalVector *x, size_t nb, ibex::IntervalVector *y,
+                      std::vector<ibex::Interval>& v_reg) const;
+
+      friend class BytecodeParser;
+      friend class BytecodeDiff;
+
+      int m_nb_inputs; //!< number of inputs, t included
+      std::vector<Instruction> m_v_instr; //!< instructions, in evaluation order
+      std::vector<ibex::Interval> m_v_cst; //!< constants of the expression
+      std::vector<int> m_v_outputs; //!< registers of the outputs
+  };
+}
+
+#endif
@@ -11,6 +11,7 @@
 #include "tubex_TFunction.h"
 #include "tubex_Tube.h"
 #include "tubex_TubeVector.h"
+#include "tubex_Exception.h"
 
 using namespace std;
 using namespace ibex;
@@ -120,14 +121,16 @@ namespace tubex
   TFunction::~TFunction()
   {
     delete m_ibex_f;
+    delete m_bytecode;
   }
 
   const TFunction& TFunction::operator=(const TFunction& f)
   {
-    if(m_ibex_f != NULL)
-      delete m_ibex_f;
-    m_ibex_f = new Function(*f.m_ibex_f);
+    set_ibex_function(new Function(*f.m_ibex_f));
+    delete m_bytecode;
+    m_bytecode = f.m_bytecode == NULL ? NULL : new IntervalBytecode(*f.m_bytecode);
     m_expr = f.m_expr;
+    m_eval_mode = f.m_eval_mode;
     TFnc::operator=(f);
     return *this;
   }
@@ -138,8 +141,9 @@ namespace tubex
     // todo: check the following
     TFunction fi(*this);
     Function ibex_fi((*fi.m_ibex_f)[i]);
-    delete fi.m_ibex_f;
-    fi.m_ibex_f = new Function(ibex_fi);
+    fi.set_ibex_function(new Function(ibex_fi));
+    if(fi.m_bytecode != NULL)
+      *fi.m_bytecode = (*m_bytecode)[i];
     fi.m_img_dim = 1;
     return fi;
   }
@@ -174,16 +178,87 @@ namespace tubex
       xdyn[i+1] = x[i];
     }
 
-    m_ibex_f = new Function(n+1, xdyn, y);
+    set_ibex_function(new Function(n+1, xdyn, y));
     m_nb_vars = n;
     m_img_dim = m_ibex_f->image_dim();
     m_intertemporal = false; // not supported yet
     m_expr = y;
+
+    // Compiled form used for the evaluations, when the syntax is supported.
+    // The expression is then parsed twice (ibex::Function, IntervalBytecode):
+    // this only adds a cost linear in its length to the construction,
+    // which does not concern the evaluations
+    try
+    {
+      m_bytecode = new IntervalBytecode(n, x, y);
+      if(m_bytecode->image_dim() != m_img_dim)
+      {
+        delete m_bytecode;
+        m_bytecode = NULL;
+      }
+    }
+
+    catch(Exception&)
+    {
+      m_bytecode = NULL;
+    }
 #ifdef _MSC_VER
     delete[] xdyn;
 #endif // _MSC_VER
   }
 
+  void TFunction::set_ibex_function(Function *f)
+  {
+    assert(f != NULL);
+    delete m_ibex_f;
+    m_ibex_f = f;
+
+    // Other threads evaluate their own copy of the function, made on demand
+    m_ibex_f_copies.reset(m_ibex_f, [this]() { return new Function(*m_ibex_f); });
+  }
+
+  bool TFunction::is_compiled() const
+  {
+    return m_bytecode != NULL;
+  }
+
+  void TFunction::set_eval_mode(EvalMode eval_mode)
+  {
+    m_eval_mode = eval_mode;
+  }
+
+  EvalMode TFunction::eval_mode() const
+  {
+    return m_eval_mode;
+  }
+
+  const IntervalVector TFunction::eval_box(const IntervalVector& box) const
+  {
+    if(m_bytecode != NULL)
+      switch(m_eval_mode)
+      {
+        case EvalMode::MEAN_VALUE:
+          return m_bytecode->eval_mean_value(box);
+        case EvalMode::CENTERED:
+          return m_bytecode->eval_centered(box);
+        default:
+          return m_bytecode->eval_vector(box);
+      }
+
+    const Function& ibex_f = m_ibex_f_copies.get();
+    IntervalVector y = ibex_f.eval_vector(box);
+
+    if(m_eval_mode == EvalMode::NATURAL || box.is_empty() || box.is_unbounded())
+      return y;
+
+    // Mean-value form, from the ibex Jacobian matrix
+    const Vector m = box.mid();
+    const IntervalVector y_m = ibex_f.eval_vector(IntervalVector(m));
+    if(y_m.is_empty()) // m outside the domain of f
+      return y;
+    return y & (y_m + ibex_f.jacobian(box) * (box - m));
+  }
+
   const Interval TFunction::eval(const Interval& t) const
   {
     assert(nb_vars() == 0);
@@ -233,14 +308,14 @@ namespace tubex
   {
     assert(nb_vars() == 0);
     IntervalVector box(1, t);
-    return m_ibex_f->eval_vector(box);
+    return eval_box(box);
   }
 
   const IntervalVector TFunction::eval_vector(const IntervalVector& x) const
   {
     assert(nb_vars() == x.size() - 1);
     assert(!is_intertemporal());
-    return m_ibex_f->eval_vector(x);
+    return eval_box(x);
   }
 
   const IntervalVector TFunction::eval_vector(int slice_id, const TubeVector& x) const
@@ -261,7 +336,7 @@ namespace tubex
     box[0] = t;
     box.put(1, x(slice_id));
 
-    return m_ibex_f->eval_vector(box);
+    return eval_box(box);
   }
 
   const IntervalVector TFunction::eval_vector(const Interval& t, const TubeVector& x) const
@@ -281,7 +356,7 @@ namespace tubex
       for(int i = 0 ; i < x.size() ; i++)
         box[i+1] = x[i](t);
 
-    return m_ibex_f->eval_vector(box);
+    return eval_box(box);
   }
 
   const TubeVector TFunction::eval_vector(const TubeVector& x) const
@@ -305,6 +380,72 @@ namespace tubex
       return y;
     }
 
+    if(m_bytecode != NULL)
+    {
+      // The slices are evaluated by chunks by the compiled expression:
+      // envelope and input gate of each slice, then the last output gate
+
+      const int k = x.nb_slices();
+      const int chunk_size = IntervalBytecode::EVAL_CHUNK_SIZE / 2;
+      vector<IntervalVector> v_box(2*min(k, chunk_size)+1, IntervalVector(nb_vars() + 1));
+      vector<IntervalVector> v_result(v_box.size(), IntervalVector(image_dim()));
+
+      vector<const Slice*> v_sx(x.size());
+      for(int i = 0 ; i < x.size() ; i++)
+        v_sx[i] = x[i].first_slice();
+
+      vector<Slice*> v_sy(y.size());
+      for(int i = 0 ; i < y.size() ; i++)
+        v_sy[i] = y[i].first_slice();
+
+      for(int j0 = 0 ; j0 < k ; j0 += chunk_size)
+      {
+        const int nb_slices = min(chunk_size, k - j0);
+        const bool last_chunk = j0 + nb_slices == k;
+        const int nb_boxes = 2*nb_slices + (last_chunk ? 1 : 0);
+
+        for(int j = 0 ; j < nb_slices ; j++)
+        {
+          v_box[2*j][0] = v_sx[0]->tdomain();
+          v_box[2*j+1][0] = v_sx[0]->tdomain().lb();
+          if(last_chunk && j == nb_slices-1)
+            v_box[2*nb_slices][0] = v_sx[0]->tdomain().ub();
+
+          for(int i = 0 ; i < nb_vars() ; i++)
+          {
+            v_box[2*j][i+1] = v_sx[i]->codomain();
+            v_box[2*j+1][i+1] = v_sx[i]->input_gate();
+            if(last_chunk && j == nb_slices-1)
+              v_box[2*nb_slices][i+1] = v_sx[i]->output_gate();
+          }
+
+          for(int i = 0 ; i < x.size() ; i++)
+            v_sx[i] = v_sx[i]->next_slice();
+        }
+
+        if(m_eval_mode == EvalMode::NATURAL)
+          m_bytecode->eval_boxes(&v_box[0], nb_boxes, &v_result[0]);
+
+        else // first-order forms, box by box
+          for(int j = 0 ; j < nb_boxes ; j++)
+            v_result[j] = eval_box(v_box[j]);
+
+        for(int i = 0 ; i < y.size() ; i++)
+        {
+          for(int j = 0 ; j < nb_slices ; j++, v_sy[i] = v_sy[i]->next_slice())
+          {
+            v_sy[i]->set_envelope(v_result[2*j][i], false);
+            v_sy[i]->set_input_gate(v_result[2*j+1][i], false);
+          }
+
+          if(last_chunk)
+            y[i].last_slice()->set_output_gate(v_result[2*nb_slices][i], false);
+        }
+      }
+
+      return y;
+    }
+
     IntervalVector box(x.size() + 1), result(y.size());
 
     const Slice **v_sx = new const Slice*[x.size()];
@@ -336,14 +477,14 @@ namespace tubex
       box[0] = v_sx[0]->tdomain();
       for(int i = 0 ; i < x.size() ; i++)
         box[i+1] = v_sx[i]->codomain();
-      result = m_ibex_f->eval_vector(box);
+      result = eval_box(box);
       for(int i = 0 ; i < y.size() ; i++)
         v_sy[i]->set_envelope(result[i], false);
 
       box[0] = box[0].lb();
       for(int i = 0 ; i < x.size() ; i++)
         box[i+1] = v_sx[i]->input_gate();
-      result = m_ibex_f->eval_vector(box);
+      result = eval_box(box);
       for(int i = 0 ; i < y.size() ; i++)
         v_sy[i]->set_input_gate(result[i], false);
 
@@ -352,7 +493,7 @@ namespace tubex
     box[0] = v_sx[0]->tdomain().ub();
     for(int i = 0 ; i < x.size() ; i++)
       box[i+1] = v_sx[i]->output_gate();
-    result = m_ibex_f->eval_vector(box);
+    result = eval_box(box);
     for(int i = 0 ; i < y.size() ; i++)
       v_sy[i]->set_output_gate(result[i], false);
 
@@ -384,7 +525,7 @@ namespace tubex
       v[0] = it->first;
       v.put(1, x(it->first));
 
-      y.set(m_ibex_f->eval_vector(v).mid(), it->first);
+      y.set(eval_box(v).mid(), it->first);
     }
 
     return y;
@@ -393,8 +534,24 @@ namespace tubex
   const TFunction TFunction::diff() const
   {
     TFunction diff_f = *this;
-    delete diff_f.m_ibex_f;
-    diff_f.m_ibex_f = new Function(m_ibex_f->diff());
+    diff_f.set_ibex_function(new Function(m_ibex_f->diff()));
+    delete diff_f.m_bytecode;
+    diff_f.m_bytecode = NULL;
+
+    // The derivative is compiled from the compiled form of a scalar function
+    if(m_bytecode != NULL && image_dim() == 1)
+    {
+      try
+      {
+        diff_f.m_bytecode = new IntervalBytecode(m_bytecode->diff());
+      }
+
+      catch(Exception&)
+      {
+        diff_f.m_bytecode = NULL; // abs, min, max: evaluated by ibex
+      }
+    }
+
     return diff_f;
   }
 }
\ No newline at end of file
@@ -14,6 +14,8 @@
 #include <string>
 #include "ibex_Function.h"
 #include "tubex_TFnc.h"
+#include "tubex_IntervalBytecode.h"
+#include "tubex_ThreadLocalCopies.h"
 #include "tubex_Trajectory.h"
 #include "tubex_TrajectoryVector.h"
 
@@ -22,6 +24,17 @@ namespace tubex
   class Slice;
   class Trajectory;
   class TrajectoryVector;
+
+  /**
+   * \enum EvalMode
+   * \brief Interval extension used for the evaluations of a TFunction
+   */
+  enum class EvalMode
+  {
+    NATURAL, ///< natural interval extension
+    MEAN_VALUE, ///< mean-value form at the midpoint of the boxes, intersected with the natural one
+    CENTERED ///< centered form with slopes (compiled expressions only, otherwise MEAN_VALUE)
+  };
   
   class TFunction : public TFnc
   {
@@ -64,14 +77,53 @@ namespace tubex
       const ibex::IntervalVector eval_vector(int slice_id, const TubeVector& x) const;
       const ibex::IntervalVector eval_vector(const ibex::Interval& t, const TubeVector& x) const;
 
+      /**
+       * \brief Returns the derivatives of this function with respect to \f$(t,x_1,\dots,x_n)\f$
+       *
+       * The derivative of a scalar function is compiled when the function is compiled,
+       * except if it involves `abs`, `min` or `max`. The derivatives of a vector function
+       * form a matrix, that is not supported by IntervalBytecode: they are evaluated by ibex.
+       *
+       * \return the derivative function
+       */
       const TFunction diff() const;
 
+      /**
+       * \brief Tests whether the evaluations of this function go through
+       *        its compiled form (see IntervalBytecode)
+       *
+       * \return `true` if the expression has been compiled
+       */
+      bool is_compiled() const;
+
+      /**
+       * \brief Sets the interval extension used for the evaluations of this function
+       *
+       * \note The CENTERED form is only available for compiled expressions (see is_compiled()):
+       *       other expressions are then evaluated with the MEAN_VALUE form.
+       *
+       * \param eval_mode interval extension (NATURAL by default)
+       */
+      void set_eval_mode(EvalMode eval_mode);
+
+      /**
+       * \brief Returns the interval extension used for the evaluations of this function
+       *
+       * \return the EvalMode set by set_eval_mode()
+       */
+      EvalMode eval_mode() const;
+
     protected:
 
       void construct_from_array(int n, const char** x, const char* y);
+      void set_ibex_function(ibex::Function *f);
+      const ibex::IntervalVector eval_box(const ibex::IntervalVector& box) const;
 
       ibex::Function *m_ibex_f = NULL;
+      ThreadLocalCopies<ibex::Function> m_ibex_f_copies; // the evaluations of an ibex::Function are not re-entrant
+      IntervalBytecode *m_bytecode = NULL; // NULL if the expression could not be compiled
       std::string m_expr; // stored here because impossible to get this value from ibex::Function
+      EvalMode m_eval_mode = EvalMode::NATURAL;
   };
 }
 
@@ -0,0 +1,283 @@
+/** 
+ *  Zonotope class
+ * ----------------------------------------------------------------------------
+ *  \date       2020
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2020 Simon Rohou
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#include <algorithm>
+#include "tubex_Zonotope.h"
+
+using namespace std;
+using namespace ibex;
+
+namespace tubex
+{
+  Zonotope::Zonotope(int n)
+    : m_c(n, Interval::EMPTY_SET)
+  {
+    assert(n > 0);
+  }
+
+  Zonotope::Zonotope(const IntervalVector& box)
+    : m_c(box)
+  {
+
+  }
+
+  Zonotope::Zonotope(const IntervalVector& center, const vector<Vector>& v_generators)
+    : m_c(center), m_v_gen(v_generators)
+  {
+    for(const auto& g : m_v_gen)
+      assert(g.size() == m_c.size());
+  }
+
+  int Zonotope::size() const
+  {
+    return m_c.size();
+  }
+
+  int Zonotope::nb_generators() const
+  {
+    return m_v_gen.size();
+  }
+
+  const IntervalVector& Zonotope::center() const
+  {
+    return m_c;
+  }
+
+  const vector<Vector>& Zonotope::generators() const
+  {
+    return m_v_gen;
+  }
+
+  const IntervalVector Zonotope::box() const
+  {
+    IntervalVector box(m_c);
+    if(is_empty())
+      return box;
+
+    for(int i = 0 ; i < size() ; i++)
+    {
+      Interval r(0.);
+      for(const auto& g : m_v_gen)
+        r += abs(Interval(g[i]));
+      box[i] += Interval(-1.,1.) * r;
+    }
+
+    return box;
+  }
+
+  bool Zonotope::is_empty() const
+  {
+    return m_c.is_empty();
+  }
+
+  bool Zonotope::is_unbounded() const
+  {
+    return m_c.is_unbounded();
+  }
+
+  void Zonotope::set_empty()
+  {
+    m_c.set_empty();
+    m_v_gen.clear();
+  }
+
+  const Zonotope& Zonotope::reduce(int max_generators)
+  {
+    assert(max_generators >= 0);
+
+    if(is_empty())
+      return *this;
+
+    // Generators sorted by decreasing criterion ||g||_1-||g||_inf,
+    // which is zero for the generators aligned with the axes
+
+    vector<pair<double,size_t> > v_criteria;
+    for(size_t k = 0 ; k < m_v_gen.size() ; k++)
+    {
+      double norm1 = 0., norm_inf = 0.;
+      for(int i = 0 ; i < size() ; i++)
+      {
+        norm1 += fabs(m_v_gen[k][i]);
+        norm_inf = max(norm_inf, fabs(m_v_gen[k][i]));
+      }
+      v_criteria.push_back(make_pair(norm1 - norm_inf, k));
+    }
+
+    sort(v_criteria.begin(), v_criteria.end(),
+      [](const pair<double,size_t>& a, const pair<double,size_t>& b) { return a.first > b.first; });
+
+    // The last generators are replaced by their interval hull
+
+    vector<bool> v_kept(m_v_gen.size(), false);
+    for(size_t k = 0 ; k < v_criteria.size() ; k++)
+    {
+      if(v_criteria[k].first > 0. && (int)k < max_generators)
+        v_kept[v_criteria[k].second] = true;
+
+      else
+        for(int i = 0 ; i < size() ; i++)
+          m_c[i] += Interval(-1.,1.) * abs(Interval(m_v_gen[v_criteria[k].second][i]));
+    }
+
+    vector<Vector> v_gen;
+    for(size_t k = 0 ; k < m_v_gen.size() ; k++)
+      if(v_kept[k])
+        v_gen.push_back(m_v_gen[k]);
+    m_v_gen.swap(v_gen);
+
+    return *this;
+  }
+
+  const Zonotope& Zonotope::operator&=(const IntervalVector& x)
+  {
+    assert(x.size() == size());
+
+    if(x.is_empty())
+      set_empty();
+
+    for(int i = 0 ; i < size() && !is_empty() ; i++)
+    {
+      if(x[i].is_unbounded())
+        continue; // only the strips are considered
+
+      Interval zi(0.);
+      for(const auto& g : m_v_gen)
+        zi += abs(Interval(g[i]));
+      zi = m_c[i] + Interval(-1.,1.) * zi;
+
+      if(zi.is_subset(x[i]))
+        continue; // no contraction
+
+      if(!zi.intersects(x[i]))
+      {
+        set_empty();
+        break;
+      }
+
+      if(m_c[i].is_unbounded())
+      {
+        // No correlation can be kept with the other components
+        m_c[i] = x[i];
+        for(auto& g : m_v_gen)
+          g[i] = 0.;
+        continue;
+      }
+
+      // Strip {x_i = y + sigma.eta, eta in [-1,1]}
+      const double y = x[i].mid();
+      const double sigma = (x[i] - y).mag();
+
+      // Weights lambda: any value provides an outer approximation of the intersection.
+      // The radius of the j-th component of the result, sum_k |G_jk - lambda_j.G_ik| + |lambda_j|.sigma,
+      // only depends on lambda_j: it is minimized by a weighted median of the G_jk/G_ik.
+      expand_center();
+      Vector lambda(size(), 0.);
+      vector<pair<double,double> > v_pts; // (value, weight)
+      for(int j = 0 ; j < size() ; j++)
+      {
+        v_pts.clear();
+        double half_weight = sigma;
+        v_pts.push_back(make_pair(0., sigma));
+        for(const auto& g : m_v_gen)
+          if(g[i] != 0.)
+          {
+            v_pts.push_back(make_pair(g[j] / g[i], fabs(g[i])));
+            half_weight += fabs(g[i]);
+          }
+        half_weight /= 2.;
+
+        sort(v_pts.begin(), v_pts.end());
+        double cumul_weight = 0.;
+        for(const auto& pt : v_pts)
+        {
+          cumul_weight += pt.second;
+          if(cumul_weight >= half_weight)
+          {
+            lambda[j] = pt.first;
+            break;
+          }
+        }
+      }
+
+      // c := c + lambda.(y - c_i)
+      const Interval ci_y = m_c[i] - y;
+      for(int j = 0 ; j < size() ; j++)
+        m_c[j] -= lambda[j] * ci_y;
+
+      // G := [(I - lambda.e_i^T).G , sigma.lambda]
+      vector<Vector> v_gen;
+      v_gen.swap(m_v_gen);
+      IntervalVector g_lambda(size());
+      for(const auto& g : v_gen)
+      {
+        for(int j = 0 ; j < size() ; j++)
+          g_lambda[j] = g[j] - lambda[j] * Interval(g[i]);
+        push_generator(g_lambda);
+      }
+
+      if(sigma != 0.)
+      {
+        for(int j = 0 ; j < size() ; j++)
+          g_lambda[j] = lambda[j] * Interval(sigma);
+        push_generator(g_lambda);
+      }
+    }
+
+    return *this;
+  }
+
+  const Zonotope& Zonotope::operator+=(const IntervalVector& x)
+  {
+    assert(x.size() == size());
+    m_c += x;
+    if(m_c.is_empty())
+      set_empty();
+    return *this;
+  }
+
+  const Zonotope& Zonotope::operator+=(const Zonotope& z)
+  {
+    assert(z.size() == size());
+    m_c += z.m_c;
+    if(m_c.is_empty())
+      set_empty();
+    else
+      m_v_gen.insert(m_v_gen.end(), z.m_v_gen.begin(), z.m_v_gen.end());
+    return *this;
+  }
+
+  void Zonotope::expand_center()
+  {
+    for(int i = 0 ; i < size() ; i++)
+      if(!m_c[i].is_unbounded() && !m_c[i].is_degenerated())
+      {
+        const double mid = m_c[i].mid();
+        Vector g(size(), 0.);
+        g[i] = (m_c[i] - mid).mag();
+        m_v_gen.push_back(g);
+        m_c[i] = Interval(mid);
+      }
+  }
+
+  void Zonotope::push_generator(const IntervalVector& g)
+  {
+    assert(g.size() == size());
+    const Vector g_mid = g.mid();
+    for(int i = 0 ; i < size() ; i++)
+      m_c[i] += Interval(-1.,1.) * (g[i] - g_mid[i]).mag();
+    m_v_gen.push_back(g_mid);
+  }
+
+  ostream& operator<<(ostream& str, const Zonotope& z)
+  {
+    str << "<" << z.m_c << ", " << z.m_v_gen.size() << " generators>" << flush;
+    return str;
+  }
+}
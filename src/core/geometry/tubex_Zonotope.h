@@ -0,0 +1,207 @@
+/** 
+ *  \file
+ *  Zonotope class
+ * ----------------------------------------------------------------------------
+ *  \date       2020
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2020 Simon Rohou
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#ifndef __TUBEX_ZONOTOPE_H__
+#define __TUBEX_ZONOTOPE_H__
+
+#include <vector>
+#include "ibex_Vector.h"
+#include "ibex_IntervalVector.h"
+#include "ibex_IntervalMatrix.h"
+
+namespace tubex
+{
+  /**
+   * \class Zonotope
+   * \brief n-dimensional zonotope \f$\langle[\mathbf{c}],\mathbf{G}\rangle=\{\mathbf{c}+\mathbf{G}\boldsymbol{\xi},
+   *        \mathbf{c}\in[\mathbf{c}],\boldsymbol{\xi}\in[-1,1]^p\}\f$
+   *
+   * The center \f$[\mathbf{c}]\f$ is a box: it gathers the generators aligned with the axes,
+   * the ones removed by order reductions, and the rounding errors of the computations,
+   * so that the zonotope is always an outer approximation. Unbounded components
+   * are supported through unbounded components of the center.
+   */
+  class Zonotope
+  {
+    public:
+
+      /// \name Definition
+      /// @{
+
+        /**
+         * \brief Creates an empty zonotope of dimension n
+         *
+         * \param n dimension
+         */
+        explicit Zonotope(int n);
+
+        /**
+         * \brief Creates a zonotope from a box
+         *
+         * \param box the box
+         */
+        explicit Zonotope(const ibex::IntervalVector& box);
+
+        /**
+         * \brief Creates a zonotope from its center and generators
+         *
+         * \param center the (possibly thick) center
+         * \param v_generators the generators, of the same dimension
+         */
+        Zonotope(const ibex::IntervalVector& center, const std::vector<ibex::Vector>& v_generators);
+
+      /// @}
+      /// \name Accessing values
+      /// @{
+
+        /**
+         * \brief Returns the dimension of the zonotope
+         *
+         * \return n
+         */
+        int size() const;
+
+        /**
+         * \brief Returns the number of generators, the axis-aligned ones of the center excepted
+         *
+         * \return p
+         */
+        int nb_generators() const;
+
+        /**
+         * \brief Returns the center of the zonotope
+         *
+         * \return the box \f$[\mathbf{c}]\f$
+         */
+        const ibex::IntervalVector& center() const;
+
+        /**
+         * \brief Returns the generators of the zonotope
+         *
+         * \return the columns of \f$\mathbf{G}\f$
+         */
+        const std::vector<ibex::Vector>& generators() const;
+
+        /**
+         * \brief Returns the interval hull of the zonotope
+         *
+         * \return the box enclosing the zonotope
+         */
+        const ibex::IntervalVector box() const;
+
+      /// @}
+      /// \name Tests
+      /// @{
+
+        /**
+         * \brief Returns true if the zonotope is empty
+         *
+         * \return true in case of empty set
+         */
+        bool is_empty() const;
+
+        /**
+         * \brief Returns true if the zonotope is unbounded
+         *
+         * \return true if one of its components is unbounded
+         */
+        bool is_unbounded() const;
+
+      /// @}
+      /// \name Setting values
+      /// @{
+
+        /**
+         * \brief Sets this zonotope to the empty set
+         */
+        void set_empty();
+
+        /**
+         * \brief Bounds the number of generators (order reduction)
+         *
+         * The generators aligned with the axes are moved to the center. Then, if
+         * more than `max_generators` remain, the ones that are the closest to their
+         * interval hull (criterion \f$\|\mathbf{g}\|_1-\|\mathbf{g}\|_\infty\f$,
+         * Girard, 2005) are replaced by their interval hull in the center.
+         *
+         * \param max_generators maximal number of generators, the center excepted
+         * \return a reference to this zonotope
+         */
+        const Zonotope& reduce(int max_generators);
+
+        /**
+         * \brief Contracts the zonotope with respect to a box
+         *
+         * The intersection of a zonotope with a box is not a zonotope: this method
+         * computes an outer approximation, by successive intersections with the strips
+         * defined by the bounded components of the box (Alamo et al., 2005). The weights
+         * of the strips minimize the radius of each component of the resulting zonotope.
+         *
+         * \param x the box
+         * \return a reference to this zonotope
+         */
+        const Zonotope& operator&=(const ibex::IntervalVector& x);
+
+        /**
+         * \brief Minkowski sum with a box
+         *
+         * \param x the box
+         * \return a reference to this zonotope
+         */
+        const Zonotope& operator+=(const ibex::IntervalVector& x);
+
+        /**
+         * \brief Minkowski sum with a zonotope
+         *
+         * \param z the zonotope
+         * \return a reference to this zonotope
+         */
+        const Zonotope& operator+=(const Zonotope& z);
+
+      /// @}
+      /// \name String
+      /// @{
+
+        /**
+         * \brief Displays a synthesis of this zonotope
+         *
+         * \param str ostream
+         * \param z zonotope to be displayed
+         * \return ostream
+         */
+        friend std::ostream& operator<<(std::ostream& str, const Zonotope& z);
+
+      /// @}
+
+    protected:
+
+      /**
+       * \brief Moves the thickness of the bounded components of the center to axis-aligned generators,
+       *        before an operation that would break their correlations
+       */
+      void expand_center();
+
+      /**
+       * \brief Adds an interval generator: its midpoint is kept as generator,
+       *        and its radius is moved to the center
+       *
+       * \param g the interval generator
+       */
+      void push_generator(const ibex::IntervalVector& g);
+
+      ibex::IntervalVector m_c; //!< thick center
+      std::vector<ibex::Vector> m_v_gen; //!< generators
+
+      friend const Zonotope operator*(const ibex::IntervalMatrix& m, const Zonotope& z);
+  };
+}
+
+#endif
@@ -0,0 +1,632 @@
+/** 
+ *  SVGBackend class
+ * ----------------------------------------------------------------------------
+ *  \date       2020
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2020 Simon Rohou
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#include <cstdio>
+#include <cmath>
+#include <cassert>
+#include <algorithm>
+#include "tubex_SVGBackend.h"
+
+using namespace std;
+using vibes::Value;
+using vibes::Params;
+
+#define SVG_HEADER_ATTRIBUTES_LENGTH 200 // reserved characters for size and viewbox
+#define SVG_ARC_STEPS 32 // number of segments for sampling arcs
+
+namespace tubex
+{
+  struct SVGBackend::SVGFile
+  {
+    string file_name;
+    FILE *fd = NULL; // opened while the image is being written
+    bool image_started = false, image_ended = false;
+    long header_pos = 0, footer_pos = 0;
+    int width = 500, height = 500;
+    bool viewbox_set = false;
+    double viewbox[4] = { 0., 1., 0., 1. };
+    double hull[4] = { 0., 0., 0., 0. };
+    bool hull_empty = true;
+    map<string,string> groups_format; // format of the groups, by group name
+
+    void add_to_hull(double x, double y)
+    {
+      if(!std::isfinite(x) || !std::isfinite(y))
+        return;
+
+      if(hull_empty)
+      {
+        hull[0] = hull[1] = x;
+        hull[2] = hull[3] = y;
+        hull_empty = false;
+      }
+
+      else
+      {
+        hull[0] = min(hull[0], x); hull[1] = max(hull[1], x);
+        hull[2] = min(hull[2], y); hull[3] = max(hull[3], y);
+      }
+    }
+
+    void write_xy(double x, double y)
+    {
+      fprintf(fd, "%.9g,%.9g ", x, y);
+      add_to_hull(x, y);
+    }
+  };
+
+  namespace
+  {
+    // Accessing the values of a message
+
+    const string& string_value(const Params& p, const string& key)
+    {
+      static const string empty;
+      const Value *v = p.find(key);
+      return v != NULL && v->isString() ? v->toString() : empty;
+    }
+
+    double number_value(const Params& p, const string& key, double default_value = 0.)
+    {
+      const Value *v = p.find(key);
+      return v != NULL && v->isNumber() ? v->toDouble() : default_value;
+    }
+
+    vector<double> numbers(const Value *v)
+    {
+      vector<double> v_numbers;
+      if(v != NULL && v->isArray())
+        for(const auto& x : v->toArray())
+          v_numbers.push_back(x.isNumber() ? x.toDouble() : NAN);
+      return v_numbers;
+    }
+
+    vector<double> numbers(const Params& p, const string& key)
+    {
+      return numbers(p.find(key));
+    }
+
+    // Styles of the shapes, from VIBes formats "edge_color[fill_color]"
+
+    string svg_color(const string& color, double& opacity)
+    {
+      static const map<string,string> m_colors = {
+        { "k", "black" }, { "w", "white" }, { "r", "red" }, { "g", "green" },
+        { "b", "blue" }, { "c", "cyan" }, { "m", "magenta" }, { "y", "yellow" },
+        { "transparent", "none" }
+      };
+
+      opacity = 1.;
+      if(color.empty())
+        return "none";
+
+      if(color[0] == '#' && color.size() == 9) // #RRGGBBAA
+      {
+        opacity = stoi(color.substr(7, 2), NULL, 16) / 255.;
+        return color.substr(0, 7);
+      }
+
+      auto it = m_colors.find(color);
+      return it == m_colors.end() ? color : it->second;
+    }
+
+    void write_style(FILE *fd, const string& format)
+    {
+      if(format.empty())
+        return; // default style of the figure
+
+      string edge = format, fill;
+      size_t i = format.find('[');
+      if(i != string::npos)
+      {
+        edge = format.substr(0, i);
+        fill = format.substr(i + 1, format.find(']', i) - i - 1);
+      }
+
+      double opacity;
+      fprintf(fd, " stroke=\"%s\"", svg_color(edge, opacity).c_str());
+      if(opacity != 1.) fprintf(fd, " stroke-opacity=\"%.3g\"", opacity);
+      fprintf(fd, " fill=\"%s\"", svg_color(fill, opacity).c_str());
+      if(opacity != 1.) fprintf(fd, " fill-opacity=\"%.3g\"", opacity);
+    }
+
+    string shape_format(const Params& shape, const map<string,string>& groups_format)
+    {
+      // An empty format stands for the format of the group, as in the VIBes viewer
+      const string& format = string_value(shape, "format");
+      if(!format.empty())
+        return format;
+
+      auto it = groups_format.find(string_value(shape, "group"));
+      return it == groups_format.end() ? "" : it->second;
+    }
+
+    void open_element(FILE *fd, const char *element, const string& format)
+    {
+      fprintf(fd, "<%s vector-effect=\"non-scaling-stroke\"", element);
+      write_style(fd, format);
+    }
+
+    bool same_path(string path1, string path2)
+    {
+      for(string *s : { &path1, &path2 })
+      {
+        s->insert(0, "/");
+        for(size_t i ; (i = s->find("//")) != string::npos ; )
+          s->erase(i, 1);
+        for(size_t i ; (i = s->find("/./")) != string::npos ; )
+          s->erase(i, 2);
+      }
+      return path1 == path2;
+    }
+
+    bool finite(const vector<double>& v)
+    {
+      for(double x : v)
+        if(!std::isfinite(x))
+          return false;
+      return true;
+    }
+  }
+
+  SVGBackend::SVGBackend(const string& path) : m_path(path)
+  {
+
+  }
+
+  SVGBackend::~SVGBackend()
+  {
+    for(auto& it : m_files)
+    {
+      end_image(it.second);
+      delete it.second;
+    }
+  }
+
+  void SVGBackend::message(const Params& msg)
+  {
+    const string& action = string_value(msg, "action");
+    const string& fig_name = string_value(msg, "figure");
+
+    if(action == "new")
+      begin_image(file(fig_name));
+
+    else if(action == "clear")
+    {
+      // A completed image is replaced by the next one;
+      // otherwise, the previous drawings of the display are kept
+      SVGFile *f = file(fig_name);
+      if(!f->image_started || f->image_ended)
+        begin_image(f);
+    }
+
+    else if(action == "close")
+    {
+      auto it = m_files.find(fig_name);
+      if(it != m_files.end())
+      {
+        end_image(it->second);
+        delete it->second;
+        m_files.erase(it);
+      }
+    }
+
+    else if(action == "set" && msg.find("object") == NULL)
+    {
+      const Value *properties = msg.find("properties");
+      if(properties == NULL || !properties->isObject())
+        return;
+
+      SVGFile *f = file(fig_name);
+      const Params& p = properties->toObject();
+
+      vector<double> v = numbers(p, "viewbox");
+      if(v.size() == 4 && finite(v))
+      {
+        copy(v.begin(), v.end(), f->viewbox);
+        f->viewbox_set = true;
+      }
+
+      f->width = (int)number_value(p, "width", f->width);
+      f->height = (int)number_value(p, "height", f->height);
+    }
+
+    else if(action == "export")
+    {
+      SVGFile *f = file(fig_name);
+      end_image(f);
+
+      // Only SVG images can be produced: other extensions are replaced
+      string export_name = string_value(msg, "file");
+      size_t i_ext = export_name.find_last_of('.');
+      if(i_ext == string::npos || export_name.find('/', i_ext) != string::npos)
+        export_name += ".svg";
+      else
+        export_name = export_name.substr(0, i_ext) + ".svg";
+
+      if(same_path(export_name, f->file_name))
+        return; // the image is already there
+
+      FILE *in = fopen(f->file_name.c_str(), "rb");
+      FILE *out = in == NULL ? NULL : fopen(export_name.c_str(), "wb");
+      if(out != NULL)
+      {
+        char buffer[BUFSIZ];
+        size_t n;
+        while((n = fread(buffer, 1, BUFSIZ, in)) > 0)
+          fwrite(buffer, 1, n, out);
+        fclose(out);
+      }
+      if(in != NULL)
+        fclose(in);
+    }
+
+    else if(action == "draw")
+    {
+      const Value *shape = msg.find("shape");
+      if(shape == NULL || !shape->isObject())
+        return;
+
+      SVGFile *f = file(fig_name);
+      const Params& p = shape->toObject();
+
+      if(string_value(p, "type") == "group")
+      {
+        f->groups_format[string_value(p, "name")] = string_value(p, "format");
+        return;
+      }
+
+      if(!f->image_started)
+        begin_image(f);
+
+      else if(f->image_ended) // appending primitives to a completed image
+      {
+        f->fd = fopen(f->file_name.c_str(), "r+b");
+        if(f->fd == NULL)
+          return;
+        fseek(f->fd, f->footer_pos, SEEK_SET);
+        f->image_ended = false;
+      }
+
+      if(f->fd != NULL)
+        draw_shape(f, p);
+    }
+
+    // Other messages (object deletions or properties)
+    // are not relevant for images drawn anew at each display
+  }
+
+  void SVGBackend::flush()
+  {
+    for(auto& it : m_files)
+      end_image(it.second);
+  }
+
+  SVGBackend::SVGFile* SVGBackend::file(const string& fig_name)
+  {
+    auto it = m_files.find(fig_name);
+    if(it != m_files.end())
+      return it->second;
+
+    string file_name = fig_name;
+    replace(file_name.begin(), file_name.end(), '/', '_');
+
+    SVGFile *f = new SVGFile;
+    f->file_name = m_path + "/" + file_name + ".svg";
+    m_files[fig_name] = f;
+    return f;
+  }
+
+  void SVGBackend::begin_image(SVGFile *f)
+  {
+    if(f->fd != NULL)
+      fclose(f->fd);
+
+    f->fd = fopen(f->file_name.c_str(), "w+b");
+    f->image_started = true;
+    f->image_ended = false;
+    f->hull_empty = true;
+
+    if(f->fd == NULL)
+      return;
+
+    fprintf(f->fd, "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"no\"?>\n");
+    fprintf(f->fd, "<svg xmlns=\"http://www.w3.org/2000/svg\" version=\"1.1\" ");
+    f->header_pos = ftell(f->fd); // size and viewbox are known at the end of the image
+    fprintf(f->fd, "%*s>\n", SVG_HEADER_ATTRIBUTES_LENGTH, "");
+    fprintf(f->fd, "<g transform=\"scale(1,-1)\" fill=\"none\" stroke=\"black\" "
+                   "stroke-width=\"1\" stroke-linejoin=\"round\">\n");
+  }
+
+  void SVGBackend::end_image(SVGFile *f)
+  {
+    if(f->fd == NULL)
+      return;
+
+    f->footer_pos = ftell(f->fd);
+    fprintf(f->fd, "</g>\n</svg>\n");
+
+    double vb[4] = { 0., 1., 0., 1. };
+    if(f->viewbox_set)
+      copy(f->viewbox, f->viewbox + 4, vb);
+    else if(!f->hull_empty)
+      copy(f->hull, f->hull + 4, vb);
+
+    if(vb[1] <= vb[0]) vb[1] = vb[0] + 1.;
+    if(vb[3] <= vb[2]) vb[3] = vb[2] + 1.;
+
+    // The y-axis is reversed by the transformation of the main group
+    char attributes[SVG_HEADER_ATTRIBUTES_LENGTH + 1];
+    snprintf(attributes, sizeof(attributes),
+             "width=\"%d\" height=\"%d\" viewBox=\"%.9g %.9g %.9g %.9g\" preserveAspectRatio=\"none\"",
+             f->width, f->height, vb[0], -vb[3], vb[1] - vb[0], vb[3] - vb[2]);
+
+    fseek(f->fd, f->header_pos, SEEK_SET);
+    fputs(attributes, f->fd); // the remaining reserved characters are blank
+
+    fclose(f->fd);
+    f->fd = NULL;
+    f->image_ended = true;
+  }
+
+  void SVGBackend::draw_shape(SVGFile *f, const Params& shape)
+  {
+    FILE *fd = f->fd;
+    const string& type = string_value(shape, "type");
+    const string format = shape_format(shape, f->groups_format);
+
+    if(type == "box")
+    {
+      vector<double> b = numbers(shape, "bounds");
+      if(b.size() < 4 || !finite(b))
+        return;
+
+      open_element(fd, "rect", format);
+      fprintf(fd, " x=\"%.9g\" y=\"%.9g\" width=\"%.9g\" height=\"%.9g\"/>\n",
+              b[0], b[2], b[1] - b[0], b[3] - b[2]);
+      f->add_to_hull(b[0], b[2]);
+      f->add_to_hull(b[1], b[3]);
+    }
+
+    else if(type == "boxes" || type == "boxes union")
+    {
+      const Value *v = shape.find("bounds");
+      if(v == NULL || !v->isArray())
+        return;
+
+      open_element(fd, "path", format);
+      fprintf(fd, " d=\"");
+      for(const auto& box : v->toArray())
+      {
+        vector<double> b = numbers(&box);
+        if(b.size() < 4 || !finite(b))
+          continue;
+
+        fprintf(fd, "M%.9g %.9gH%.9gV%.9gH%.9gZ", b[0], b[2], b[1], b[3], b[0]);
+        f->add_to_hull(b[0], b[2]);
+        f->add_to_hull(b[1], b[3]);
+      }
+      fprintf(fd, "\"/>\n");
+    }
+
+    else if(type == "ellipse")
+    {
+      vector<double> c = numbers(shape, "center");
+      if(c.size() < 2)
+        return;
+
+      double a, b, orientation;
+      vector<double> cov = numbers(shape, "covariance");
+
+      if(cov.size() == 4) // confidence ellipse: axes from the eigenvalues of the covariance
+      {
+        double k = number_value(shape, "sigma", 1.);
+        double m = (cov[0] + cov[3]) / 2., d = sqrt(pow((cov[0] - cov[3]) / 2., 2) + cov[1] * cov[1]);
+        a = k * sqrt(max(0., m + d));
+        b = k * sqrt(max(0., m - d));
+        orientation = 0.5 * atan2(2. * cov[1], cov[0] - cov[3]) * 180. / M_PI;
+      }
+
+      else
+      {
+        vector<double> axis = numbers(shape, "axis");
+        if(axis.size() < 2)
+          return;
+        a = axis[0]; b = axis[1];
+        orientation = number_value(shape, "orientation");
+      }
+
+      if(!finite(c) || !std::isfinite(a) || !std::isfinite(b))
+        return;
+
+      vector<double> angles = numbers(shape, "angles");
+      if(angles.size() == 2) // sector
+      {
+        double rot = orientation * M_PI / 180.;
+        open_element(fd, "polygon", format);
+        fprintf(fd, " points=\"");
+        f->write_xy(c[0], c[1]);
+        for(int i = 0 ; i <= SVG_ARC_STEPS ; i++)
+        {
+          double t = (angles[0] + i * (angles[1] - angles[0]) / SVG_ARC_STEPS) * M_PI / 180.;
+          double x = a * cos(t), y = b * sin(t);
+          f->write_xy(c[0] + x * cos(rot) - y * sin(rot), c[1] + x * sin(rot) + y * cos(rot));
+        }
+        fprintf(fd, "\"/>\n");
+      }
+
+      else
+      {
+        open_element(fd, "ellipse", format);
+        fprintf(fd, " cx=\"%.9g\" cy=\"%.9g\" rx=\"%.9g\" ry=\"%.9g\"", c[0], c[1], a, b);
+        if(orientation != 0.)
+          fprintf(fd, " transform=\"rotate(%.9g %.9g %.9g)\"", orientation, c[0], c[1]);
+        fprintf(fd, "/>\n");
+        double r = max(a, b);
+        f->add_to_hull(c[0] - r, c[1] - r);
+        f->add_to_hull(c[0] + r, c[1] + r);
+      }
+    }
+
+    else if(type == "pie")
+    {
+      vector<double> c = numbers(shape, "center");
+      vector<double> rho = numbers(shape, "rho"), theta = numbers(shape, "theta");
+      if(c.size() < 2 || rho.size() < 2 || theta.size() < 2 || !finite(c) || !finite(rho) || !finite(theta))
+        return;
+
+      open_element(fd, "polygon", format);
+      fprintf(fd, " points=\"");
+      for(int k = 0 ; k < 2 ; k++) // outer arc, then inner arc backwards
+        for(int i = 0 ; i <= SVG_ARC_STEPS ; i++)
+        {
+          double t = (k == 0 ? theta[0] + i * (theta[1] - theta[0]) / SVG_ARC_STEPS
+                             : theta[1] - i * (theta[1] - theta[0]) / SVG_ARC_STEPS) * M_PI / 180.;
+          double r = rho[1 - k];
+          f->write_xy(c[0] + r * cos(t), c[1] + r * sin(t));
+        }
+      fprintf(fd, "\"/>\n");
+    }
+
+    else if(type == "ring")
+    {
+      vector<double> c = numbers(shape, "center"), rho = numbers(shape, "rho");
+      if(c.size() < 2 || rho.size() < 2 || !finite(c) || !finite(rho))
+        return;
+
+      open_element(fd, "path", format);
+      fprintf(fd, " fill-rule=\"evenodd\" d=\"");
+      for(int k = 1 ; k >= 0 ; k--)
+        fprintf(fd, "M%.9g %.9gA%.9g %.9g 0 1 0 %.9g %.9gA%.9g %.9g 0 1 0 %.9g %.9gZ",
+                c[0] + rho[k], c[1], rho[k], rho[k], c[0] - rho[k], c[1],
+                rho[k], rho[k], c[0] + rho[k], c[1]);
+      fprintf(fd, "\"/>\n");
+      f->add_to_hull(c[0] - rho[1], c[1] - rho[1]);
+      f->add_to_hull(c[0] + rho[1], c[1] + rho[1]);
+    }
+
+    else if(type == "point" || type == "points")
+    {
+      const Value *v = shape.find(type == "point" ? "point" : "centers");
+      if(v == NULL || !v->isArray())
+        return;
+
+      vector<Value> v_points;
+      if(type == "point")
+        v_points.push_back(*v);
+      const vector<Value>& points = type == "point" ? v_points : v->toArray();
+
+      // With a fixed scale, the radius is in pixels: the point is drawn as a dot
+      bool dot = number_value(shape, "FixedScale") != 0.; // booleans are sent as integers
+
+      if(shape.find("Radius") != NULL && !dot)
+      {
+        double r = number_value(shape, "Radius");
+        vector<double> p = numbers(&points[0]);
+        if(p.size() < 2 || !finite(p))
+          return;
+
+        open_element(fd, "circle", format);
+        fprintf(fd, " cx=\"%.9g\" cy=\"%.9g\" r=\"%.9g\"/>\n", p[0], p[1], r);
+        f->add_to_hull(p[0] - r, p[1] - r);
+        f->add_to_hull(p[0] + r, p[1] + r);
+        return;
+      }
+
+      // Points are drawn as dots of constant size
+      string color = format.substr(0, format.find('['));
+      if(color.empty() && format.find('[') != string::npos)
+        color = format.substr(format.find('[') + 1, format.find(']') - format.find('[') - 1);
+      double opacity;
+      color = svg_color(color.empty() ? "k" : color, opacity);
+
+      double width = dot ? 2. * number_value(shape, "Radius", 1.5) : 3.;
+      fprintf(fd, "<path vector-effect=\"non-scaling-stroke\" stroke=\"%s\" stroke-width=\"%.9g\" stroke-linecap=\"round\"", color.c_str(), width);
+      if(opacity != 1.) fprintf(fd, " stroke-opacity=\"%.3g\"", opacity);
+      fprintf(fd, " d=\"");
+      for(const auto& point : points)
+      {
+        vector<double> p = numbers(&point);
+        if(p.size() < 2 || !finite(p))
+          continue;
+        fprintf(fd, "M%.9g %.9gh0", p[0], p[1]);
+        f->add_to_hull(p[0], p[1]);
+      }
+      fprintf(fd, "\"/>\n");
+    }
+
+    else if(type == "line" || type == "arrow")
+    {
+      const Value *v = shape.find("points");
+      if(v == NULL || !v->isArray())
+        return;
+
+      open_element(fd, "polyline", format);
+      fprintf(fd, " points=\"");
+      vector<double> p, prev_p;
+      for(const auto& point : v->toArray())
+      {
+        vector<double> q = numbers(&point);
+        if(q.size() < 2 || !finite(q))
+          continue;
+        f->write_xy(q[0], q[1]);
+        prev_p = p; p = q;
+      }
+      fprintf(fd, "\"/>\n");
+
+      double tip_length = number_value(shape, "tip_length");
+      if(type == "arrow" && tip_length > 0. && prev_p.size() >= 2)
+      {
+        double angle = atan2(p[1] - prev_p[1], p[0] - prev_p[0]);
+        open_element(fd, "polygon", format);
+        fprintf(fd, " points=\"");
+        f->write_xy(p[0], p[1]);
+        f->write_xy(p[0] + tip_length * cos(angle + 5. * M_PI / 6.), p[1] + tip_length * sin(angle + 5. * M_PI / 6.));
+        f->write_xy(p[0] + tip_length * cos(angle - 5. * M_PI / 6.), p[1] + tip_length * sin(angle - 5. * M_PI / 6.));
+        fprintf(fd, "\"/>\n");
+      }
+    }
+
+    else if(type == "polygon")
+    {
+      const Value *v = shape.find("bounds");
+      if(v == NULL || !v->isArray())
+        return;
+
+      open_element(fd, "polygon", format);
+      fprintf(fd, " points=\"");
+      for(const auto& point : v->toArray())
+      {
+        vector<double> q = numbers(&point);
+        if(q.size() >= 2 && finite(q))
+          f->write_xy(q[0], q[1]);
+      }
+      fprintf(fd, "\"/>\n");
+    }
+
+    else if(type.compare(0, 7, "vehicle") == 0) // drawn as an isosceles triangle, for any vehicle type
+    {
+      vector<double> c = numbers(shape, "center");
+      double l = number_value(shape, "length", 1.);
+      double rot = number_value(shape, "orientation") * M_PI / 180.;
+      if(c.size() < 2 || !finite(c) || !std::isfinite(l))
+        return;
+
+      open_element(fd, "polygon", format);
+      fprintf(fd, " points=\"");
+      f->write_xy(c[0] + l / 2. * cos(rot), c[1] + l / 2. * sin(rot));
+      f->write_xy(c[0] - l / 2. * cos(rot) - l / 4. * sin(rot), c[1] - l / 2. * sin(rot) + l / 4. * cos(rot));
+      f->write_xy(c[0] - l / 2. * cos(rot) + l / 4. * sin(rot), c[1] - l / 2. * sin(rot) - l / 4. * cos(rot));
+      fprintf(fd, "\"/>\n");
+    }
+
+    // Rasters are not rendered
+  }
+}
@@ -0,0 +1,113 @@
+/**
+ *  \file
+ *  SVGBackend class
+ * ----------------------------------------------------------------------------
+ *  \date       2020
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2020 Simon Rohou
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#ifndef __TUBEX_SVGBACKEND_H__
+#define __TUBEX_SVGBACKEND_H__
+
+#include <map>
+#include <string>
+#include "vibes.h"
+
+namespace tubex
+{
+  /**
+   * \class SVGBackend
+   * \brief Headless rendering of the figures into SVG files, without VIBes viewer
+   *
+   * Once given to `vibes::beginDrawing()`, this backend receives the drawing commands
+   * of any figure (VIBesFigTube, VIBesFigTubeVector, VIBesFigPaving, VIBesFigMap...)
+   * and writes each figure in the file `<path>/<figure name>.svg`.
+   *
+   * Primitives are streamed to the files as they are drawn: the scene is not kept
+   * in memory. A figure is rendered anew when it is cleared after the end of
+   * a display, for instance at each call to `show()`.
+   *
+   * \code
+   * SVGBackend svg("figures");
+   * vibes::beginDrawing(&svg);
+   * VIBesFigTube fig("x", &x);
+   * fig.show();
+   * vibes::endDrawing(); // figures/x.svg
+   * \endcode
+   */
+  class SVGBackend : public vibes::Backend
+  {
+    public:
+
+      /**
+       * \brief Creates an SVG backend
+       *
+       * \param path existing directory in which the SVG files will be written
+       */
+      SVGBackend(const std::string& path = ".");
+
+      /**
+       * \brief SVGBackend destructor, completing the files being written
+       */
+      ~SVGBackend();
+
+      /**
+       * \brief Processes a drawing command
+       *
+       * \param msg the VIBes message
+       */
+      void message(const vibes::Params& msg);
+
+      /**
+       * \brief Completes the files being written, at the end of a display
+       */
+      void flush();
+
+    protected:
+
+      /**
+       * \brief SVG file of a figure, and the related drawing state
+       */
+      struct SVGFile;
+
+      /**
+       * \brief Returns the file of a figure, created if needed
+       *
+       * \param fig_name name of the figure
+       * \return a pointer to the related file
+       */
+      SVGFile* file(const std::string& fig_name);
+
+      /**
+       * \brief Starts a new image of the figure (the previous one is overwritten)
+       *
+       * \param f the file of the figure
+       */
+      static void begin_image(SVGFile *f);
+
+      /**
+       * \brief Completes the image of the figure, that can then be read
+       *
+       * \note Further primitives can be appended to the image afterwards.
+       *
+       * \param f the file of the figure
+       */
+      static void end_image(SVGFile *f);
+
+      /**
+       * \brief Writes a shape in the file of a figure
+       *
+       * \param f the file of the figure
+       * \param shape the VIBes description of the shape
+       */
+      static void draw_shape(SVGFile *f, const vibes::Params& shape);
+
+      std::string m_path; //!< directory of the SVG files
+      std::map<std::string,SVGFile*> m_files; //!< files of the figures, by figure name
+  };
+}
+
+#endif
@@ -140,14 +140,43 @@ namespace tubex
 
   void VIBesFig::draw_boxes(const vector<IntervalVector>& v_boxes, const vibes::Params& params)
   {
-    for(const auto& box : v_boxes)
-      draw_box(box, params);
+    draw_boxes(v_boxes, "", params);
   }
 
   void VIBesFig::draw_boxes(const vector<IntervalVector>& v_boxes, const string& color, const vibes::Params& params)
   {
+    // Boxes are sent in a single message,
+    // degenerated ones are drawn as points (as in draw_box)
+    vector<IntervalVector> v_drawn_boxes;
+
     for(const auto& box : v_boxes)
-      draw_box(box, color, params);
+    {
+      assert(box.size() == 2);
+
+      if(box.is_unbounded())
+        continue;
+
+      else if(box.max_diam() == 0.)
+        draw_point(Point(box), color, params);
+
+      else
+      {
+        m_view_box |= box;
+        v_drawn_boxes.push_back(box);
+      }
+    }
+
+    if(v_drawn_boxes.empty())
+      return;
+
+    vibes::Params params_this_fig(params);
+    params_this_fig["figure"] = name();
+
+    if(color != "")
+      vibes::drawBoxes(v_drawn_boxes, color, params_this_fig);
+
+    else
+      vibes::drawBoxes(v_drawn_boxes, params_this_fig);
   }
   
   void VIBesFig::draw_line(const vector<vector<double> >& v_pts, const vibes::Params& params)
@@ -148,6 +148,8 @@ namespace tubex
       /**
        * \brief Draws a set of boxes
        *
+       * \note The boxes are sent to the viewer as one single message.
+       *
        * \param v_boxes vector of 2d IntervalVector to be displayed
        * \param params VIBes parameters related to the boxes
        */
@@ -156,6 +158,8 @@ namespace tubex
       /**
        * \brief Draws a set of boxes
        *
+       * \note The boxes are sent to the viewer as one single message.
+       *
        * \param v_boxes vector of 2d IntervalVector to be displayed
        * \param color the optional color of the boxes (black by default) 
        * \param params VIBes parameters related to the boxes (none by default)
@@ -42,6 +42,7 @@ namespace tubex
   void VIBesFigPaving::show()
   {
     // todo: deal with color maps defined with any kind of values
+    vibes::Batch batch; // messages sent at once, at the end of the method
     vibes::clearGroup(name(), "val_in");
     vibes::clearGroup(name(), "val_maybe");
     vibes::clearGroup(name(), "val_out");
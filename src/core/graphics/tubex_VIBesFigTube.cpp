@@ -8,6 +8,8 @@
  *              the GNU Lesser General Public License (LGPL).
  */
 
+#include <cmath>
+#include <algorithm>
 #include "ibex_Interval.h"
 #include "ibex_IntervalVector.h"
 #include "tubex_Tools.h"
@@ -42,6 +44,8 @@ namespace tubex
   
   void VIBesFigTube::show(bool detail_slices)
   {
+    vibes::Batch batch; // messages sent at once, at the end of the method
+
     typename map<const Tube*,FigTubeParams>::const_iterator it_tubes;
     for(it_tubes = m_map_tubes.begin(); it_tubes != m_map_tubes.end(); it_tubes++)
       m_view_box |= draw_tube(it_tubes->first, detail_slices);
@@ -329,6 +333,10 @@ namespace tubex
       // - one in which each slice is shown
       // - one in which only the polygon envelope of the tube is shown
 
+      // Slices thinner than a pixel are aggregated into columns: the number
+      // of primitives then depends on the width of the figure, not on the tube
+      bool aggregated_slices = detail_slices && tube->nb_slices() > m_width;
+
       // First, displaying background.
       // The background is the previous version of the tube (before contraction).
       // Always displayed as a polygon.
@@ -349,7 +357,9 @@ namespace tubex
 
           vibes::clearGroup(name(), group_name_bckgrnd);
           vibes::Params params_background = vibesParams("figure", name(), "group", group_name_bckgrnd);
-          if(!m_map_tubes[tube].tube_copy->is_empty())
+          if(aggregated_slices)
+            draw_boxes(tube_columns(m_map_tubes[tube].tube_copy, m_width), params_background);
+          else if(!m_map_tubes[tube].tube_copy->is_empty())
             draw_polygon(m_map_tubes[tube].tube_copy->polygon_envelope(), params_background);
         }
       }
@@ -360,9 +370,17 @@ namespace tubex
         vibes::clearGroup(name(), group_name);
         vibes::clearGroup(name(), group_name + "_polygons");
         vibes::clearGroup(name(), group_name + "_gates");
-        vibes::clearGroup(name(), group_name + "_slices");
 
-        if(detail_slices)
+        if(!aggregated_slices) // otherwise, the columns are incrementally redrawn
+        {
+          vibes::clearGroup(name(), group_name + "_slices");
+          m_map_tubes[tube].v_columns.clear();
+        }
+
+        if(aggregated_slices)
+          draw_columns(tube, m_width, group_name + "_slices");
+
+        else if(detail_slices)
         {
           vibes::Params params_foreground_slices = vibesParams("group", group_name + "_slices");
           vibes::Params params_foreground_polygons = vibesParams("group", group_name + "_polygons");
@@ -374,21 +392,41 @@ namespace tubex
           if(m_map_tubes[tube].tube_derivative != NULL)
             deriv_slice = m_map_tubes[tube].tube_derivative->first_slice();
 
-          draw_gate(slice->input_gate(), tube->tdomain().lb(), params_foreground_gates);
+          // Boxes of slices and gates are gathered, and then sent
+          // in two messages instead of one per slice and per gate
+          vector<IntervalVector> v_slices_boxes, v_gates_boxes;
+          v_slices_boxes.reserve(tube->nb_slices());
+          v_gates_boxes.reserve(tube->nb_slices() + 1);
+
+          Interval gate = slice->input_gate();
+          if(gate.is_degenerated())
+            draw_gate(gate, tube->tdomain().lb(), params_foreground_gates); // point
+          else
+            v_gates_boxes.push_back(gate_box(gate, tube->tdomain().lb()));
 
           while(slice != NULL)
           {
-            if(deriv_slice != NULL)
-              draw_slice(*slice, *deriv_slice, params_foreground_slices, params_foreground_polygons);
+            if(!slice->codomain().is_empty())
+            {
+              v_slices_boxes.push_back(slice->box());
+              if(deriv_slice != NULL)
+                draw_polygon(slice->polygon(*deriv_slice), params_foreground_polygons);
+            }
+
+            gate = slice->output_gate();
+            if(gate.is_degenerated())
+              draw_gate(gate, slice->tdomain().ub(), params_foreground_gates); // point
             else
-              draw_slice(*slice, params_foreground_slices);
+              v_gates_boxes.push_back(gate_box(gate, slice->tdomain().ub()));
 
-            draw_gate(slice->output_gate(), slice->tdomain().ub(), params_foreground_gates);
             slice = slice->next_slice();
             
             if(deriv_slice != NULL)
               deriv_slice = deriv_slice->next_slice();
           }
+
+          draw_boxes(v_slices_boxes, params_foreground_slices);
+          draw_boxes(v_gates_boxes, params_foreground_gates);
         }
 
         else
@@ -412,6 +450,81 @@ namespace tubex
     draw_box(slice.box(), params);
   }
 
+  void VIBesFigTube::draw_columns(const Tube *tube, int nb_columns, const string& group_name)
+  {
+    assert(tube != NULL);
+    assert(nb_columns > 0);
+
+    const Interval tdomain = tube->tdomain();
+    vector<IntervalVector>& v_columns = m_map_tubes[tube].v_columns;
+
+    if((int)v_columns.size() != nb_columns
+      || v_columns.front()[0].lb() != tdomain.lb() || v_columns.back()[0].ub() != tdomain.ub()
+      || !vibes::retainsObjects()) // figure rendered anew (headless backend)
+    {
+      // New layout of the columns: complete redraw
+      vibes::clearGroup(name(), group_name);
+      v_columns.assign(nb_columns, IntervalVector(2, Interval::EMPTY_SET));
+    }
+
+    vector<IntervalVector> v_new_columns = tube_columns(tube, nb_columns);
+    vibes::Params params = vibesParams("group", group_name);
+
+    for(int i = 0 ; i < nb_columns ; i++)
+    {
+      const IntervalVector& column = v_new_columns[i];
+
+      if(column == v_columns[i])
+        continue; // unchanged since the last display
+
+      string object_name = Tools::add_int(group_name, i);
+
+      if(!v_columns[i].is_empty() && !v_columns[i].is_unbounded()) // previously drawn
+        vibes::removeObject(name(), object_name);
+
+      v_columns[i] = column;
+
+      if(!column.is_empty())
+      {
+        params["name"] = object_name;
+        draw_box(column, params);
+      }
+    }
+  }
+
+  const vector<IntervalVector> VIBesFigTube::tube_columns(const Tube *tube, int nb_columns)
+  {
+    assert(tube != NULL);
+    assert(nb_columns > 0);
+
+    const Interval tdomain = tube->tdomain();
+    double dt = tdomain.diam() / nb_columns;
+    vector<IntervalVector> v_columns(nb_columns, IntervalVector(2, Interval::EMPTY_SET));
+
+    for(int i = 0 ; i < nb_columns ; i++)
+      v_columns[i][0] = Interval(tdomain.lb() + i * dt, i == nb_columns - 1 ? tdomain.ub() : tdomain.lb() + (i + 1) * dt);
+
+    // One pass over the slices, without modifying the tube (no synthesis tree):
+    // each slice is added to the columns its tdomain overlaps
+
+    for(const Slice *s = tube->first_slice() ; s != NULL ; s = s->next_slice())
+    {
+      int i0 = max(0, min(nb_columns - 1, (int)floor((s->tdomain().lb() - tdomain.lb()) / dt)));
+      if(i0 > 0 && v_columns[i0][0].lb() > s->tdomain().lb()) // rounding of the division
+        i0--;
+
+      for(int i = i0 ; i < nb_columns && v_columns[i][0].lb() < s->tdomain().ub() ; i++)
+        if(v_columns[i][0].ub() > s->tdomain().lb())
+          v_columns[i][1] |= s->codomain();
+    }
+
+    for(int i = 0 ; i < nb_columns ; i++)
+      if(v_columns[i][1].is_empty())
+        v_columns[i].set_empty();
+
+    return v_columns;
+  }
+
   void VIBesFigTube::draw_slice(const Slice& slice, const Slice& deriv_slice, const vibes::Params& params_slice, const vibes::Params& params_polygon)
   {
     assert(slice.tdomain() == deriv_slice.tdomain());
@@ -432,12 +545,15 @@ namespace tubex
       draw_point(Point(t, gate.lb()), params);
 
     else
-    {
-      IntervalVector gate_box(2);
-      gate_box[0] = t; gate_box[0].inflate(ibex::next_float(0.));
-      gate_box[1] = trunc_inf(gate);
-      draw_box(gate_box, params);
-    }
+      draw_box(gate_box(gate, t), params);
+  }
+
+  const IntervalVector VIBesFigTube::gate_box(const Interval& gate, double t)
+  {
+    IntervalVector box(2);
+    box[0] = t; box[0].inflate(ibex::next_float(0.));
+    box[1] = trunc_inf(gate);
+    return box;
   }
   
   const IntervalVector VIBesFigTube::draw_trajectory(const Trajectory *traj)
@@ -73,6 +73,12 @@ namespace tubex
       /**
        * \brief Displays this figure with optional details
        *
+       * \note When slices are thinner than a pixel of the figure, they are aggregated
+       *       into columns of one pixel width, and only the columns that changed
+       *       since the last display are sent to the viewer. In this mode, the gates
+       *       and the polygons computed from the derivative are not drawn: they
+       *       would be thinner than a pixel, and as many as the slices.
+       *
        * \param detail_slices if `true`, each slice will be displayed as a box,
        *        otherwise, only polygon envelopes of the tubes will be shown (fast display)
        */
@@ -303,6 +309,30 @@ namespace tubex
        */
       void draw_slice(const Slice& slice, const vibes::Params& params);
 
+      /**
+       * \brief Draws a tube as a set of columns, each column being the hull of the slices it covers
+       *
+       * \note Only the columns that changed since the last call are redrawn.
+       *
+       * \param tube a const pointer to a Tube object to be shown
+       * \param nb_columns number of columns, usually the width of the figure in pixels
+       * \param group_name name of the VIBes group of the columns
+       */
+      void draw_columns(const Tube *tube, int nb_columns, const std::string& group_name);
+
+      /**
+       * \brief Splits the tdomain of a tube into columns of same width,
+       *        each column being the hull of the slices it covers
+       *
+       * \note The columns are computed in one pass over the slices. The tube is not
+       *       modified (in particular, its synthesis tree is not enabled).
+       *
+       * \param tube a const pointer to a Tube object
+       * \param nb_columns number of columns
+       * \return the columns, as 2d boxes
+       */
+      static const std::vector<ibex::IntervalVector> tube_columns(const Tube *tube, int nb_columns);
+
       /**
        * \brief Draws a slice knowing its derivative
        *
@@ -322,6 +352,15 @@ namespace tubex
        */
       void draw_gate(const ibex::Interval& gate, double t, const vibes::Params& params);
 
+      /**
+       * \brief Returns the thin box representing a non-degenerated gate
+       *
+       * \param gate the codomain
+       * \param t the tdomain input
+       * \return the box to be displayed
+       */
+      static const ibex::IntervalVector gate_box(const ibex::Interval& gate, double t);
+
       /**
        * \brief Draws a trajectory
        *
@@ -342,6 +381,7 @@ namespace tubex
         std::map<TubeColorType,std::string> m_colors; //!< map of colors `<TubeColorType,html_color_code>`
         const Tube *tube_copy = NULL; //!< to display previous values in background, before any new contraction
         const Tube *tube_derivative = NULL; //!< to display thinner envelopes (polygons) enclosed by the slices
+        std::vector<ibex::IntervalVector> v_columns; //!< columns displayed by the last draw_columns() call
       };
 
       /**
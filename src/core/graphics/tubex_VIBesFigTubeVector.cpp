@@ -80,6 +80,7 @@ namespace tubex
 
   void VIBesFigTubeVector::show(bool detail_slices)
   {
+    vibes::Batch batch; // messages of all the subfigures sent at once
     for(int i = 0 ; i < subfigs_number() ; i++)
       m_v_figs[i]->show(detail_slices);
   }
@@ -97,6 +97,35 @@ namespace vibes
       /// Current figure name (client-maintained state)
       string current_fig="default";
 
+      /// Number of nested batches in progress (messages are buffered while positive)
+      int batch_depth=0;
+
+      /// Messages waiting for the end of the current batch
+      string batch_buffer;
+
+      /// Optional in-process backend, replacing the channel
+      Backend *backend=0;
+
+      /// Writes a message to the channel, or appends it to the batch buffer
+      void sendMessage(const Params &msg)
+      {
+        if (backend)
+        {
+          backend->message(msg);
+          return;
+        }
+
+        string json = Value(msg).toJSONString().append("\n\n");
+
+        if (batch_depth > 0)
+          batch_buffer.append(json);
+        else
+        {
+          fputs(json.c_str(),channel);
+          fflush(channel);
+        }
+      }
+
   }
 
   //
@@ -126,51 +155,95 @@ namespace vibes
     channel=fopen(fileName.c_str(),"a");
   }
 
+  void beginDrawing(Backend *b)
+  {
+    backend=b;
+  }
+
+  bool retainsObjects()
+  {
+    return (backend == 0);
+  }
+
   void endDrawing()
   {
+    if (backend)
+    {
+      backend->flush();
+      backend=0;
+      batch_depth=0;
+      return;
+    }
+
+    if (!batch_buffer.empty())
+      fputs(batch_buffer.c_str(),channel);
+    batch_buffer.clear();
+    batch_depth=0;
     fclose(channel);
   }
 
+  void beginBatch()
+  {
+    batch_depth++;
+  }
+
+  void endBatch()
+  {
+    assert(batch_depth > 0);
+    if (--batch_depth > 0)
+      return;
+
+    if (backend)
+    {
+      backend->flush();
+      return;
+    }
+
+    if (batch_buffer.empty())
+      return;
+
+    // The whole batch is written at once, with a single flush
+    fwrite(batch_buffer.data(),1,batch_buffer.size(),channel);
+    fflush(channel);
+    batch_buffer.clear();
+  }
+
   //
   // Figure management
   //
 
   void newFigure(const std::string &figureName)
   {
-    std::string msg;
+    Params msg;
     if (!figureName.empty()) current_fig = figureName;
-    msg ="{\"action\":\"new\","
-          "\"figure\":\""+(figureName.empty()?current_fig:figureName)+"\"}\n\n";
-    fputs(msg.c_str(),channel);
-    fflush(channel);
+    msg["action"] = "new";
+    msg["figure"] = figureName.empty()?current_fig:figureName;
+    sendMessage(msg);
   }
 
   void clearFigure(const std::string &figureName)
   {
-    std::string msg;
-    msg="{\"action\":\"clear\","
-         "\"figure\":\""+(figureName.empty()?current_fig:figureName)+"\"}\n\n";
-    fputs(msg.c_str(),channel);
-    fflush(channel);
+    Params msg;
+    msg["action"] = "clear";
+    msg["figure"] = figureName.empty()?current_fig:figureName;
+    sendMessage(msg);
   }
 
   void closeFigure(const std::string &figureName)
   {
-    std::string msg;
-    msg="{\"action\":\"close\","
-         "\"figure\":\""+(figureName.empty()?current_fig:figureName)+"\"}\n\n";
-    fputs(msg.c_str(),channel);
-    fflush(channel);
+    Params msg;
+    msg["action"] = "close";
+    msg["figure"] = figureName.empty()?current_fig:figureName;
+    sendMessage(msg);
   }
 
   void saveImage(const std::string &fileName, const std::string &figureName)
   {
-      std::string msg;
-      msg="{\"action\":\"export\","
-           "\"figure\":\""+(figureName.empty()?current_fig:figureName)+"\","
-           "\"file\":\""+fileName+"\"}\n\n";
-      fputs(msg.c_str(),channel);
-      fflush(channel);
+      Params msg;
+      msg["action"] = "export";
+      msg["figure"] = figureName.empty()?current_fig:figureName;
+      msg["file"] = fileName;
+      sendMessage(msg);
   }
 
   void selectFigure(const std::string &figureName)
@@ -220,8 +293,7 @@ namespace vibes
     msg["figure"] = params.pop("figure",current_fig);
     msg["shape"] = (params, "type", "box", "bounds", v4d);
 
-    fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel);
-    fflush(channel);
+    sendMessage(msg);
   }
 
   void drawBox(const vector<double> &bounds, Params params)
@@ -234,8 +306,7 @@ namespace vibes
     msg["figure"] = params.pop("figure",current_fig);
     msg["shape"] = (params, "type", "box", "bounds", vector<Value>(bounds.begin(),bounds.end()));
 
-    fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel);
-    fflush(channel);
+    sendMessage(msg);
   }
 
 
@@ -251,8 +322,7 @@ namespace vibes
                               "axis", va,
                               "orientation", rot);
 
-      fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel);
-      fflush(channel);
+      sendMessage(msg);
   }
 
   void drawConfidenceEllipse(const double &cx, const double &cy,
@@ -269,8 +339,7 @@ namespace vibes
                               "covariance", vcov,
                               "sigma", K);
 
-      fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel);
-      fflush(channel);
+      sendMessage(msg);
   }
 
   void drawConfidenceEllipse(const vector<double> &center, const vector<double> &cov,
@@ -284,8 +353,7 @@ namespace vibes
                               "covariance", vector<Value>(cov.begin(),cov.end()),
                               "sigma", K);
 
-      fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel);
-      fflush(channel);
+      sendMessage(msg);
   }
 
   void drawSector(const double &cx, const double &cy, const double &a, const double &b,
@@ -304,8 +372,7 @@ namespace vibes
                               "orientation", 0,
                               "angles", startEnd);
 
-      fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel);
-      fflush(channel);
+      sendMessage(msg);
   }
 
   void drawPie(const double &cx, const double &cy, const double &r_min, const double &r_max,
@@ -323,8 +390,7 @@ namespace vibes
                               "rho", rMinMax,
                               "theta", thetaMinMax);
 
-      fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel);
-      fflush(channel);
+      sendMessage(msg);
   }
 
   void drawPoint(const double &cx, const double &cy, Params params)
@@ -335,8 +401,7 @@ namespace vibes
       msg["figure"]=params.pop("figure",current_fig);
       msg["shape"]=(params, "type","point",
                             "point",cxy);
-      fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel);
-      fflush(channel);
+      sendMessage(msg);
   }
 
   void drawPoint(const double &cx, const double &cy, const double &radius, Params params)
@@ -347,8 +412,7 @@ namespace vibes
       msg["figure"]=params.pop("figure",current_fig);
       msg["shape"]=(params, "type","point",
                             "point",cxy,"Radius",radius);
-      fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel);
-      fflush(channel);
+      sendMessage(msg);
   }
 
   void drawRing(const double &cx, const double &cy, const double &r_min, const double &r_max, Params params)
@@ -361,8 +425,7 @@ namespace vibes
       msg["shape"] = (params, "type", "ring",
                               "center", cxy,
                               "rho", rMinMax);
-      fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel);
-      fflush(channel);
+      sendMessage(msg);
   }
 
   void drawBoxes(const std::vector<std::vector<double> > &bounds, Params params)
@@ -373,8 +436,7 @@ namespace vibes
      msg["shape"] = (params, "type", "boxes",
                              "bounds", bounds);
 
-     fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel);
-     fflush(channel);
+     sendMessage(msg);
   }
 
   void drawBoxesUnion(const std::vector<std::vector<double> > &bounds, Params params)
@@ -385,8 +447,7 @@ namespace vibes
      msg["shape"] = (params, "type", "boxes union",
                              "bounds", bounds);
 
-     fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel);
-     fflush(channel);
+     sendMessage(msg);
   }
 
   void drawLine(const std::vector<std::vector<double> > &points, Params params)
@@ -397,8 +458,7 @@ namespace vibes
      msg["shape"] = (params, "type", "line",
                              "points", points);
 
-     fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel);
-     fflush(channel);
+     sendMessage(msg);
   }
 
   void drawLine(const std::vector<double> &x, const std::vector<double> &y, Params params)
@@ -420,8 +480,7 @@ namespace vibes
      msg["shape"] = (params, "type", "line",
                              "points", points);
 
-     fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel);
-     fflush(channel);
+     sendMessage(msg);
   }
 
   //void drawPoints(const std::vector<std::vector<double> > &points, Params params)
@@ -467,8 +526,7 @@ namespace vibes
      msg["shape"] = (params, "type", "points",
                              "centers", points);
 
-     fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel);
-     fflush(channel);
+     sendMessage(msg);
   }
 
   //void drawPoints(const std::vector<double> &x, const std::vector<double> y, const std::vector<double> &colorLevels, Params params)
@@ -537,8 +595,7 @@ namespace vibes
                            "points", points,
                            "tip_length", tip_length);
 
-    fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel);
-    fflush(channel);
+    sendMessage(msg);
   }
 
   void drawArrow(const std::vector<std::vector<double> > &points, const double &tip_length, Params params)
@@ -550,8 +607,7 @@ namespace vibes
                            "points", points,
                            "tip_length", tip_length);
 
-    fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel);
-    fflush(channel);
+    sendMessage(msg);
   }
 
   void drawArrow(const std::vector<double> &x, const std::vector<double> &y, const double &tip_length, Params params)
@@ -574,8 +630,7 @@ namespace vibes
                             "points", points,
                             "tip_length", tip_length);
 
-    fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel);
-    fflush(channel);
+    sendMessage(msg);
   }
 
   void drawPolygon(const std::vector<double> &x, const std::vector<double> &y, Params params)
@@ -597,8 +652,7 @@ namespace vibes
     msg["shape"] = (params, "type", "polygon",
                            "bounds", points);
 
-    fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel);
-    fflush(channel);
+    sendMessage(msg);
   }
 
   void drawVehicle(const double &cx, const double &cy, const double &rot, const double &length, Params params)
@@ -612,8 +666,7 @@ namespace vibes
                               "length", length,
                               "orientation", rot);
 
-      fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel);
-      fflush(channel);
+      sendMessage(msg);
   }
 
   void drawAUV(const double &cx, const double &cy, const double &rot, const double &length, Params params)
@@ -627,8 +680,7 @@ namespace vibes
                               "length", length,
                               "orientation", rot);
 
-      fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel);
-      fflush(channel);
+      sendMessage(msg);
   }
 
   void drawTank(const double &cx, const double &cy, const double &rot, const double &length, Params params)
@@ -642,8 +694,7 @@ namespace vibes
                               "length", length,
                               "orientation", rot);
 
-      fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel);
-      fflush(channel);
+      sendMessage(msg);
   }
 
   void drawRaster(const std::string& rasterFilename, const double &xlb, const double &yub, const double &xres, const double &yres, Params params)
@@ -660,8 +711,7 @@ namespace vibes
                             "scale", scale
                    );
 
-    fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel);
-    fflush(channel);
+    sendMessage(msg);
   }
 
 
@@ -674,8 +724,7 @@ namespace vibes
      msg["shape"] = (params, "type", "group",
                              "name", name);
 
-     fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel);
-     fflush(channel);
+     sendMessage(msg);
   }
 
   void clearGroup(const std::string &figureName, const std::string &groupName)
@@ -685,8 +734,7 @@ namespace vibes
      msg["figure"] = figureName;
      msg["group"] = groupName;
 
-     fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel);
-     fflush(channel);
+     sendMessage(msg);
   }
 
   void clearGroup(const std::string &groupName)
@@ -702,8 +750,7 @@ namespace vibes
      msg["figure"] = figureName;
      msg["object"] = objectName;
 
-     fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel);
-     fflush(channel);
+     sendMessage(msg);
   }
 
   void removeObject(const std::string &objectName)
@@ -720,8 +767,7 @@ namespace vibes
      msg["figure"] = figureName;
      msg["properties"] = properties;
 
-     fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel);
-     fflush(channel);
+     sendMessage(msg);
   }
 
   void setFigureProperties(const Params &properties)
@@ -738,8 +784,7 @@ namespace vibes
      msg["object"] = objectName;
      msg["properties"] = properties;
 
-     fputs(Value(msg).toJSONString().append("\n\n").c_str(), channel);
-     fflush(channel);
+     sendMessage(msg);
   }
 
   void setObjectProperties(const std::string &objectName, const Params &properties)
@@ -105,6 +105,16 @@ namespace vibes {
         /*explicit */Value(const Params &p) : _object(&p), _type(vt_object) {}
         bool empty() {return (_type == vt_none);}
         std::string toJSONString() const;
+
+        // Read access, for in-process backends
+        bool isNumber() const {return (_type == vt_integer || _type == vt_decimal);}
+        bool isString() const {return (_type == vt_string);}
+        bool isArray() const {return (_type == vt_array);}
+        bool isObject() const {return (_type == vt_object);}
+        double toDouble() const {return (_type == vt_integer ? _integer : _decimal);}
+        const std::string &toString() const {return _string;}
+        const std::vector<Value> &toArray() const {return _array;}
+        const Params &toObject() const {return *_object;}
     };
 
     /*!
@@ -148,6 +158,7 @@ namespace vibes {
         template<typename T> Params(const std::string & name, const T &p) {_values[name] = p;}
         Value & operator[](const std::string &key) {return _values[key];}
         Value pop(const std::string &key, const Value &value_not_found = Value());
+        const Value *find(const std::string &key) const {KeyValueMap::const_iterator it = _values.find(key); return (it == _values.end() ? 0 : &it->second);}
         NameHelper operator, (const std::string &s);
         Params& operator& (const Params &p) { for(KeyValueMap::const_iterator it = p._values.begin(); it != p._values.end(); ++it) _values[it->first] = it->second; return *this;}
         std::size_t size() const { return _values.size(); }
@@ -224,6 +235,45 @@ namespace vibes {
   /// Close connection to the viewer or the drawing file.
   void endDrawing();
 
+  /// Start buffering the messages in memory instead of sending them one by one.
+  /// Batches can be nested: messages are sent when the outermost batch ends.
+  void beginBatch();
+
+  /// End the current batch. If it is the outermost one, all buffered messages are sent at once.
+  void endBatch();
+
+  /// Scoped batch: beginBatch() at construction, endBatch() at destruction,
+  /// so that the batch is ended even if an exception is thrown in the scope.
+  class Batch {
+  public:
+      Batch() { beginBatch(); }
+      ~Batch() { endBatch(); }
+  private:
+      Batch(const Batch&);
+      Batch& operator=(const Batch&);
+  };
+
+  /**
+   * An in-process drawing backend, receiving the messages instead of the VIBes viewer.
+   *
+   * Messages have the same key-value structure as the JSON messages sent to the viewer.
+   */
+  class Backend {
+  public:
+      virtual ~Backend() {}
+      /// Process a message. The message and its values are only valid during this call.
+      virtual void message(const Params &msg) = 0;
+      /// End of the outermost batch (or of the drawing): the figures can be rendered.
+      virtual void flush() {}
+  };
+
+  /// Start VIBes without viewer: all commands are processed by \a backend, which is not owned.
+  void beginDrawing(Backend *backend);
+
+  /// Return true if drawn objects remain displayed until they are removed (VIBes viewer, file),
+  /// false if figures are rendered anew after each batch (in-process backend).
+  bool retainsObjects();
+
   /** @} */ // end of group connection
 
 
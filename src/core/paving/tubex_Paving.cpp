@@ -9,8 +9,14 @@
  */
 
 #include <list>
+#include <deque>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
 #include <iostream>
+#include <algorithm>
 #include "tubex_Paving.h"
+#include "tubex_ThreadPool.h"
 #include "ibex_LargestFirst.h"
 
 using namespace std;
@@ -35,6 +41,59 @@ namespace tubex
     }
   }
 
+  // Pool of nodes
+
+  static const size_t s_pool_max_size = 4096; // maximal number of free nodes kept by a thread
+  static thread_local bool s_pool_closed = false; // trivially destructible: valid until the end of the thread
+
+  struct NodePool
+  {
+    ~NodePool()
+    {
+      s_pool_closed = true; // nodes released later on are no longer kept
+      while(free_list != NULL)
+      {
+        void *node = free_list;
+        free_list = *static_cast<void**>(node);
+        ::operator delete(node);
+      }
+    }
+
+    void *free_list = NULL; // available nodes, as a linked list
+    size_t size = 0; // number of available nodes
+  };
+
+  static thread_local NodePool s_pool; // one pool per thread, without lock
+
+  void* Paving::operator new(size_t size)
+  {
+    if(size != sizeof(Paving) // derived classes with additional members
+      || s_pool_closed || s_pool.free_list == NULL)
+      return ::operator new(size);
+
+    void *node = s_pool.free_list;
+    s_pool.free_list = *static_cast<void**>(node);
+    s_pool.size--;
+    return node;
+  }
+
+  void Paving::operator delete(void *p, size_t size)
+  {
+    if(p == NULL)
+      return;
+
+    if(size != sizeof(Paving) || s_pool_closed || s_pool.size >= s_pool_max_size)
+    {
+      ::operator delete(p);
+      return;
+    }
+
+    // The node is kept for future allocations of this thread
+    *static_cast<void**>(p) = s_pool.free_list;
+    s_pool.free_list = p;
+    s_pool.size++;
+  }
+
   // Binary tree structure
 
   Paving* Paving::get_first_subpaving()
@@ -104,6 +163,118 @@ namespace tubex
     return m_first_subpaving == NULL;
   }
 
+  // Parallel computation
+
+  struct Paving::WorkStealingQueues
+  {
+    WorkStealingQueues(int nb_threads, const function<bool(Paving*,int)>& compute_node)
+      : v_deques(nb_threads), v_mutexes(nb_threads), nb_pending(0), nb_queued(0), nb_idle(0), compute_node(compute_node)
+    {
+
+    }
+
+    vector<deque<Paving*> > v_deques; //!< one queue of subpavings per thread
+    vector<mutex> v_mutexes; //!< one lock per queue
+    atomic<int> nb_pending; //!< number of subpavings still to be processed
+    atomic<int> nb_queued; //!< number of subpavings waiting in the queues
+    atomic<int> nb_idle; //!< number of threads waiting for subpavings
+    mutex idle_mutex; //!< lock for the idle threads
+    condition_variable idle_cv; //!< wakes up the idle threads
+    const function<bool(Paving*,int)> compute_node; //!< processing of a subpaving
+
+    void wake_up_idle_threads()
+    {
+      // nb_idle is incremented under idle_mutex before testing the condition:
+      // either the idle thread sees the update, or it is seen here as idle
+      if(nb_idle > 0)
+      {
+        { lock_guard<mutex> lock(idle_mutex); }
+        idle_cv.notify_all();
+      }
+    }
+  };
+
+  void Paving::compute_in_parallel(const function<bool(Paving*,int)>& compute_node, int nb_threads)
+  {
+    assert(nb_threads >= 1);
+
+    // Shared with the tasks of the pool, that may only start once the paving is computed:
+    // they then find no subpaving to process
+    shared_ptr<WorkStealingQueues> queues = make_shared<WorkStealingQueues>(nb_threads, compute_node);
+    queues->v_deques[0].push_back(this);
+    queues->nb_pending = 1;
+    queues->nb_queued = 1;
+
+    // The calling thread is the first worker, the other ones are tasks of the global pool
+    for(int i = 1 ; i < nb_threads ; i++)
+      ThreadPool::global().submit([queues, i]() { compute_worker(i, queues->compute_node, *queues); });
+
+    compute_worker(0, queues->compute_node, *queues);
+  }
+
+  void Paving::compute_worker(int worker_id, const function<bool(Paving*,int)>& compute_node, WorkStealingQueues& queues)
+  {
+    int nb_threads = queues.v_deques.size();
+
+    while(queues.nb_pending > 0)
+    {
+      Paving *p = NULL;
+
+      // Own queue: depth-first order
+
+        {
+          lock_guard<mutex> lock(queues.v_mutexes[worker_id]);
+          if(!queues.v_deques[worker_id].empty())
+          {
+            p = queues.v_deques[worker_id].back();
+            queues.v_deques[worker_id].pop_back();
+          }
+        }
+
+      // Otherwise, stealing the oldest (largest) subpaving of another thread
+
+        for(int i = 1 ; p == NULL && i < nb_threads ; i++)
+        {
+          int victim_id = (worker_id + i) % nb_threads;
+          lock_guard<mutex> lock(queues.v_mutexes[victim_id]);
+          if(!queues.v_deques[victim_id].empty())
+          {
+            p = queues.v_deques[victim_id].front();
+            queues.v_deques[victim_id].pop_front();
+          }
+        }
+
+      if(p == NULL) // waiting for new subpavings, or for the end of the computation
+      {
+        unique_lock<mutex> lock(queues.idle_mutex);
+        queues.nb_idle++;
+        queues.idle_cv.wait(lock, [&queues] { return queues.nb_queued > 0 || queues.nb_pending == 0; });
+        queues.nb_idle--;
+        continue;
+      }
+
+      queues.nb_queued--;
+
+      if(compute_node(p, worker_id))
+      {
+        assert(!p->is_leaf());
+        queues.nb_pending += 2; // before the decrement below, for termination
+
+        {
+          lock_guard<mutex> lock(queues.v_mutexes[worker_id]);
+          queues.v_deques[worker_id].push_back(p->m_second_subpaving);
+          queues.v_deques[worker_id].push_back(p->m_first_subpaving);
+        }
+
+        queues.nb_queued += 2;
+        queues.wake_up_idle_threads();
+      }
+
+      if(--queues.nb_pending == 0)
+        queues.wake_up_idle_threads();
+    }
+  }
+
   // Flags
 
   bool Paving::flag() const
@@ -164,49 +335,124 @@ namespace tubex
     }
   }
 
-  // todo: bool compare_subset(const ConnectedSubset* x1, const ConnectedSubset* x2)
-  // todo: {
-  // todo:   return x1->get_items().size() > x2->get_items().size();
-  // todo: }
+  static bool compare_subset(const ConnectedSubset& x1, const ConnectedSubset& x2)
+  {
+    return x1.get_items().size() > x2.get_items().size();
+  }
 
-  vector<ConnectedSubset> Paving::get_connected_subsets(bool sort_by_size) const
+  static int find_root(vector<int>& v_parents, int i)
   {
-    reset_flags();
+    while(v_parents[i] != i)
+    {
+      v_parents[i] = v_parents[v_parents[i]]; // path halving
+      i = v_parents[i];
+    }
+    return i;
+  }
 
-    const Paving *p;
+  vector<ConnectedSubset> Paving::get_connected_subsets(bool sort_by_size) const
+  {
     SetValue val = SetValue::MAYBE | SetValue::IN;
     vector<ConnectedSubset> v_connected_subsets;
 
-    while((p = get_first_leaf(val, true)) != NULL)
-    {
-      vector<const Paving*> v_subset_items;
-      list<const Paving*> l;
-      l.push_back(p);
+    // 1. Leaves to be gathered
 
-      while(!l.empty())
-      {
-        const Paving *e = l.front();
-        l.pop_front();
+      unordered_map<const Paving*,int> m_leaf_ids;
+      vector<const Paving*> v_leaves;
+      unordered_set<const Paving*> s_nodes;
+      get_leaves(val, m_leaf_ids, v_leaves, s_nodes);
+
+    // 2. Union-find over the adjacent leaves
+
+      vector<int> v_parents(v_leaves.size());
+      for(size_t i = 0 ; i < v_parents.size() ; i++)
+        v_parents[i] = i;
 
-        v_subset_items.push_back(e);
-        e->set_flag();
+      union_adjacent_leaves(this, this, m_leaf_ids, s_nodes, v_parents);
 
-        vector<const Paving*> v_neighbours;
-        e->get_neighbours(v_neighbours, val, true);
+    // 3. Connected subsets, ordered by their first leaf
 
-        for(size_t i = 0 ; i < v_neighbours.size() ; i++)
+      vector<vector<const Paving*> > v_subsets_items;
+      vector<int> v_subset_ids(v_leaves.size(), -1);
+
+      for(size_t i = 0 ; i < v_leaves.size() ; i++)
+      {
+        int root = find_root(v_parents, i);
+        if(v_subset_ids[root] == -1)
         {
-          v_neighbours[i]->set_flag();
-          l.push_back(v_neighbours[i]);
+          v_subset_ids[root] = v_subsets_items.size();
+          v_subsets_items.push_back(vector<const Paving*>());
         }
+        v_subsets_items[v_subset_ids[root]].push_back(v_leaves[i]);
       }
 
-      v_connected_subsets.push_back(ConnectedSubset(v_subset_items));
-    }
+      for(const auto& v_items : v_subsets_items)
+        v_connected_subsets.push_back(ConnectedSubset(v_items));
 
-    // todo: if(sort_by_size)
-    // todo:   sort(v_connected_subsets.begin(), v_connected_subsets.end(), compare_subset);
+    if(sort_by_size)
+      stable_sort(v_connected_subsets.begin(), v_connected_subsets.end(), compare_subset);
 
     return v_connected_subsets;
   }
+
+  bool Paving::get_leaves(SetValue val, unordered_map<const Paving*,int>& m_leaf_ids, vector<const Paving*>& v_leaves, unordered_set<const Paving*>& s_nodes) const
+  {
+    bool found = false;
+
+    if(is_leaf())
+    {
+      if(m_value & val)
+      {
+        m_leaf_ids[this] = v_leaves.size();
+        v_leaves.push_back(this);
+        found = true;
+      }
+    }
+
+    else
+    {
+      found |= m_first_subpaving->get_leaves(val, m_leaf_ids, v_leaves, s_nodes);
+      found |= m_second_subpaving->get_leaves(val, m_leaf_ids, v_leaves, s_nodes);
+    }
+
+    if(found)
+      s_nodes.insert(this);
+    return found;
+  }
+
+  void Paving::union_adjacent_leaves(const Paving *p1, const Paving *p2, const unordered_map<const Paving*,int>& m_leaf_ids, const unordered_set<const Paving*>& s_nodes, vector<int>& v_parents)
+  {
+    if(s_nodes.find(p1) == s_nodes.end() || s_nodes.find(p2) == s_nodes.end()
+      || !p1->box().intersects(p2->box()))
+      return;
+
+    if(p1 == p2)
+    {
+      if(!p1->is_leaf())
+      {
+        union_adjacent_leaves(p1->m_first_subpaving, p1->m_first_subpaving, m_leaf_ids, s_nodes, v_parents);
+        union_adjacent_leaves(p1->m_second_subpaving, p1->m_second_subpaving, m_leaf_ids, s_nodes, v_parents);
+        union_adjacent_leaves(p1->m_first_subpaving, p1->m_second_subpaving, m_leaf_ids, s_nodes, v_parents);
+      }
+    }
+
+    else if(p1->is_leaf() && p2->is_leaf())
+    {
+      int root1 = find_root(v_parents, m_leaf_ids.at(p1));
+      int root2 = find_root(v_parents, m_leaf_ids.at(p2));
+      // The root of a class is its first leaf in depth-first order
+      if(root1 < root2) v_parents[root2] = root1;
+      else v_parents[root1] = root2;
+    }
+
+    else
+    {
+      // Descending the largest node
+      if(p1->is_leaf() || (!p2->is_leaf() && p2->box().max_diam() > p1->box().max_diam()))
+        swap(p1, p2);
+
+      union_adjacent_leaves(p1->m_first_subpaving, p2, m_leaf_ids, s_nodes, v_parents);
+      union_adjacent_leaves(p1->m_second_subpaving, p2, m_leaf_ids, s_nodes, v_parents);
+    }
+  }
 }
\ No newline at end of file
@@ -12,6 +12,9 @@
 #ifndef __TUBEX_PAVING_H__
 #define __TUBEX_PAVING_H__
 
+#include <functional>
+#include <unordered_map>
+#include <unordered_set>
 #include "tubex_Set.h"
 #include "tubex_ConnectedSubset.h"
 
@@ -42,7 +45,30 @@ namespace tubex
       /**
        * \brief Paving destructor
        */
-      ~Paving();
+      virtual ~Paving();
+
+      /**
+       * \brief Allocates a paving node from the pool of nodes of the calling thread
+       *
+       * \note Released nodes are kept in a free list of the releasing thread, and reused
+       *       by its next bisections, which avoids a heap allocation for most of them.
+       *       The free lists are not shared among threads, so that no lock is needed.
+       *       Beyond 4096 free nodes, and at the end of the thread, the nodes
+       *       are returned to the system. Objects of derived classes are allocated
+       *       with the default allocator.
+       *
+       * \param size size of the object to be allocated
+       * \return a pointer to the allocated memory
+       */
+      static void* operator new(std::size_t size);
+
+      /**
+       * \brief Gives back a paving node to the pool of nodes
+       *
+       * \param p pointer to the memory to be released
+       * \param size size of the released object
+       */
+      static void operator delete(void *p, std::size_t size);
 
       /// @}
       /// \name Binary tree structure
@@ -181,9 +207,12 @@ namespace tubex
        * as the union of two or more disjoint non-empty open subsets.
        *
        * \note Note that this method is preferably called from the root Paving.
+       * \note Leaves are gathered by union-find over the pairs of adjacent
+       *       leaves, enumerated in one traversal of the tree.
        *
        * \param sort_by_size (optional) if `true` then the subsets will be
        *                     sort by the number of boxes they are made of
+       *                     (in decreasing order)
        * \return the set of connected subsets
        */
       std::vector<ConnectedSubset> get_connected_subsets(bool sort_by_size = false) const;
@@ -192,9 +221,72 @@ namespace tubex
 
     protected:
 
+      /**
+       * \brief Gathers the leaves of some value, in depth-first order
+       *
+       * \param val the value of the leaves we are looking for
+       * \param m_leaf_ids the leaves, associated with their depth-first rank
+       * \param v_leaves the leaves, in depth-first order
+       * \param s_nodes the nodes (leaves or not) containing at least one of these leaves
+       * \return `true` if this paving contains at least one of these leaves
+       */
+      bool get_leaves(SetValue val,
+          std::unordered_map<const Paving*,int>& m_leaf_ids,
+          std::vector<const Paving*>& v_leaves,
+          std::unordered_set<const Paving*>& s_nodes) const;
+
+      /**
+       * \brief Merges the union-find classes of the adjacent leaves of two subpavings
+       *
+       * Both subpavings are descended together, and only the pairs of nodes
+       * with intersecting boxes are explored.
+       *
+       * \param p1 first subpaving
+       * \param p2 second subpaving (may be p1)
+       * \param m_leaf_ids the leaves to be considered, with their depth-first rank
+       * \param s_nodes the nodes containing at least one of these leaves
+       * \param v_parents union-find parents of the leaves (by rank)
+       */
+      static void union_adjacent_leaves(const Paving *p1, const Paving *p2,
+          const std::unordered_map<const Paving*,int>& m_leaf_ids,
+          const std::unordered_set<const Paving*>& s_nodes,
+          std::vector<int>& v_parents);
+
+      /**
+       * \brief Queues of subpavings shared by the threads of a parallel computation
+       */
+      struct WorkStealingQueues;
+
+      /**
+       * \brief Computes this paving by distributing its subpavings over a work-stealing pool of threads
+       *
+       * Each subpaving is processed by `compute_node`, that returns `true` when the
+       * two subpavings of the node (bisected or already existing) have to be processed too.
+       * The calling thread takes part in the computation, the other threads are tasks of the
+       * global ThreadPool. With one thread, the computation is made in the calling thread,
+       * in depth-first order.
+       *
+       * \param compute_node function processing a subpaving, given the index of the calling thread
+       * \param nb_threads number of threads
+       */
+      void compute_in_parallel(const std::function<bool(Paving*,int)>& compute_node, int nb_threads);
+
+      /**
+       * \brief Processes subpavings until the whole paving is computed
+       *
+       * The thread pops the last subpaving of its queue (depth-first order),
+       * or steals the first one (the largest) from the queue of another thread.
+       *
+       * \param worker_id index of the thread, and of its queue
+       * \param compute_node function processing a subpaving
+       * \param queues queues shared by the threads
+       */
+      static void compute_worker(int worker_id, const std::function<bool(Paving*,int)>& compute_node, WorkStealingQueues& queues);
+
       mutable bool m_flag; //!< optional flag, can be used by search algorithms
       Paving *m_root = NULL; //!< pointer to the root
       Paving *m_first_subpaving = NULL, *m_second_subpaving = NULL; //!< tree structure
+
   };
 }
 
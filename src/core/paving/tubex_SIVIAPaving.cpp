@@ -11,6 +11,7 @@
 #include <list>
 #include <iostream>
 #include "tubex_SIVIAPaving.h"
+#include "tubex_ThreadPool.h"
 
 using namespace std;
 using namespace ibex;
@@ -28,6 +29,45 @@ namespace tubex
     assert(f.nb_var() == box().size());
     assert(f.image_dim() == y.size());
 
+    if(compute_node(f, y, precision))
+    {
+      ((SIVIAPaving*)m_first_subpaving)->compute(f, y, precision);
+      ((SIVIAPaving*)m_second_subpaving)->compute(f, y, precision);
+    }
+  }
+
+  void SIVIAPaving::compute(const Function& f, const IntervalVector& y, float precision, int nb_threads)
+  {
+    assert(precision > 0.);
+    assert(nb_threads >= 0);
+    assert(f.nb_var() == box().size());
+    assert(f.image_dim() == y.size());
+
+    if(nb_threads == 0)
+      nb_threads = ThreadPool::global().nb_threads();
+
+    if(nb_threads == 1)
+    {
+      compute(f, y, precision);
+      return;
+    }
+
+    vector<Function*> v_f; // evaluations of a Function are not thread-safe
+    for(int i = 0 ; i < nb_threads ; i++)
+      v_f.push_back(new Function(f));
+
+    compute_in_parallel([&](Paving *p, int worker_id)
+      {
+        return static_cast<SIVIAPaving*>(p)->compute_node(*v_f[worker_id], y, precision);
+      },
+      nb_threads);
+
+    for(auto& f_i : v_f)
+      delete f_i;
+  }
+
+  bool SIVIAPaving::compute_node(const Function& f, const IntervalVector& y, float precision)
+  {
     IntervalVector result = f.eval_vector(box());
 
     if(result.is_subset(y))
@@ -42,8 +82,9 @@ namespace tubex
     else
     {
       bisect();
-      ((SIVIAPaving*)m_first_subpaving)->compute(f, y, precision);
-      ((SIVIAPaving*)m_second_subpaving)->compute(f, y, precision);
+      return true;
     }
+
+    return false;
   }
-}
\ No newline at end of file
+}
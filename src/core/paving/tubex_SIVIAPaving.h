@@ -45,7 +45,34 @@ namespace tubex
        */
       void compute(const ibex::Function& f, const ibex::IntervalVector& y, float precision);
 
+      /**
+       * \brief Computes the paving from the constraint \f$\mathbf{f}(\mathbf{x})\in[\mathbf{y}]\f$,
+       *        using several threads.
+       *
+       * \note Subpavings are distributed over a work-stealing pool of threads,
+       *       each thread evaluating its own copy of \f$\mathbf{f}\f$.
+       *       The resulting paving is the same as with the sequential computation.
+       *
+       * \param f IBEX static function \f$\mathbf{f}\f$, possibly non-linear
+       * \param y box \f$[\mathbf{y}]\f$
+       * \param precision precision \f$\epsilon\f$ of the SIVIA approximation
+       * \param nb_threads number of threads, `0` for the number of threads of the global ThreadPool
+       */
+      void compute(const ibex::Function& f, const ibex::IntervalVector& y, float precision, int nb_threads);
+
       /// @}
+
+    protected:
+
+      /**
+       * \brief Tests this paving, and bisects it if no conclusion can be made
+       *
+       * \param f IBEX static function \f$\mathbf{f}\f$
+       * \param y box \f$[\mathbf{y}]\f$
+       * \param precision precision \f$\epsilon\f$ of the SIVIA approximation
+       * \return `true` if the paving has been bisected
+       */
+      bool compute_node(const ibex::Function& f, const ibex::IntervalVector& y, float precision);
   };
 }
 
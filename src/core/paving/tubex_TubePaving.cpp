@@ -9,49 +9,170 @@
  */
 
 #include <list>
+#include <limits>
+#include <algorithm>
 #include <iostream>
 #include "tubex_TubePaving.h"
+#include "tubex_ThreadPool.h"
 
 using namespace std;
 using namespace ibex;
 
 namespace tubex
 {
+  struct TubePaving::SlicesIndex
+  {
+    SlicesIndex(const TubeVector& x)
+      : v_trees(x.size()), v_nb_leaves(x.size()), v_t_ub(x.size())
+    {
+      for(int j = 0 ; j < x.size() ; j++)
+      {
+        // Components may have different slicings: one tree per component
+        int nb_slices = x[j].nb_slices();
+        int& nb_leaves = v_nb_leaves[j];
+        nb_leaves = 1;
+        while(nb_leaves < nb_slices)
+          nb_leaves *= 2;
+
+        // Leaves: codomains of the slices, ordered by index (padding leaves are empty)
+        vector<Interval>& tree = v_trees[j];
+        tree.resize(2 * nb_leaves, Interval::EMPTY_SET);
+
+        int k = nb_leaves;
+        for(const Slice *s = x[j].first_slice() ; s != NULL ; s = s->next_slice())
+        {
+          tree[k++] = s->codomain();
+          v_t_ub[j].push_back(s->tdomain().ub());
+        }
+
+        // Nodes: hulls of their subtrees
+        for(int i = nb_leaves - 1 ; i > 0 ; i--)
+          tree[i] = tree[2*i] | tree[2*i+1];
+      }
+    }
+
+    int nb_slices(int j) const
+    {
+      return v_t_ub[j].size();
+    }
+
+    const Interval& codomain(int j, int k) const
+    {
+      return v_trees[j][v_nb_leaves[j] + k];
+    }
+
+    double t_lb(int j, int k) const
+    {
+      return k == 0 ? -numeric_limits<double>::infinity() : v_t_ub[j][k-1];
+    }
+
+    double t_ub(int j, int k) const
+    {
+      return v_t_ub[j][k];
+    }
+
+    int first_slice_intersecting(int j, const Interval& y, int k, int node, int node_k0, int node_kf) const
+    {
+      if(node_kf < k || !v_trees[j][node].intersects(y))
+        return -1;
+
+      if(node_k0 == node_kf)
+        return node_k0;
+
+      int mid = (node_k0 + node_kf) / 2;
+      int k_first = first_slice_intersecting(j, y, k, 2*node, node_k0, mid);
+      return k_first != -1 ? k_first : first_slice_intersecting(j, y, k, 2*node+1, mid+1, node_kf);
+    }
+
+    bool next_slices_intersecting(const IntervalVector& y, double t, vector<int>& v_k) const
+    {
+      // Looking for the first time interval, after t, over which the slices
+      // of all the components intersect the box
+      const int n = v_trees.size();
+
+      while(true)
+      {
+        double t_lb_max = t, t_ub_min = numeric_limits<double>::infinity();
+
+        for(int j = 0 ; j < n ; j++)
+        {
+          // First slice of the component ending after t
+          int k = upper_bound(v_t_ub[j].begin(), v_t_ub[j].end(), t) - v_t_ub[j].begin();
+          if(k == nb_slices(j))
+            return false;
+
+          v_k[j] = first_slice_intersecting(j, y[j], k, 1, 0, v_nb_leaves[j] - 1);
+          if(v_k[j] == -1)
+            return false;
+
+          t_lb_max = max(t_lb_max, t_lb(j, v_k[j]));
+          t_ub_min = min(t_ub_min, t_ub(j, v_k[j]));
+        }
+
+        if(t_lb_max < t_ub_min) // the slices overlap
+          return true;
+
+        t = t_lb_max; // at least one of the slices ends before t_lb_max
+      }
+    }
+
+    vector<vector<Interval> > v_trees; //!< one binary tree per component, stored as an array
+    vector<int> v_nb_leaves; //!< number of leaves of each tree, power of two
+    vector<vector<double> > v_t_ub; //!< upper bounds of the tdomains of the slices, for each component
+  };
+
   TubePaving::TubePaving(const IntervalVector& init_box) : Paving(init_box, SetValue::MAYBE)
   {
 
   }
 
   void TubePaving::compute(float precision, const TubeVector& x)
+  {
+    compute(precision, x, 1);
+  }
+
+  void TubePaving::compute(float precision, const TubeVector& x, int nb_threads)
   {
     assert(precision > 0.);
+    assert(nb_threads >= 0);
     assert(x.size() == size());
 
-    IntervalVector y = box();
-    vector<Interval> v_t_inv;
-    x.invert(y, v_t_inv);
+    if(nb_threads == 0)
+      nb_threads = ThreadPool::global().nb_threads();
 
-    bool is_out = v_t_inv.empty();
-    bool is_in = false;
+    SlicesIndex index(x);
+    vector<vector<int> > v_slices_k(nb_threads, vector<int>(size())); // one buffer per thread
 
-    for(size_t i = 0 ; i < v_t_inv.size() && !is_in ; i++)
-    {
-      const Slice **s = new const Slice*[size()];
-      for(int j = 0 ; j < size() ; j++)
-        s[j] = x[j].slice(v_t_inv[i].lb());
-
-      while(!is_in && s[0] != NULL && s[0]->tdomain().ub() <= v_t_inv[i].ub())
+    compute_in_parallel([&](Paving *p, int worker_id)
       {
-        bool is_in_i = true;
+        return static_cast<TubePaving*>(p)->compute_node(precision, index, v_slices_k[worker_id]);
+      },
+      nb_threads);
+  }
+
+  bool TubePaving::compute_node(float precision, const SlicesIndex& index, vector<int>& v_k)
+  {
+    const IntervalVector& y = box();
+    bool is_out = true, is_in = false;
 
-        for(int j = 0 ; j < size() && is_in_i ; j++)
-          is_in_i &= y[j].is_subset(s[j]->codomain());
+    // Only the slices intersecting the box, for all the components, are considered
 
-        is_in |= is_in_i;
+    assert((int)v_k.size() == size());
+    double t = -numeric_limits<double>::infinity();
 
-        for(int j = 0 ; j < size() ; j++)
-          s[j] = s[j]->next_slice();
+    while(!is_in && index.next_slices_intersecting(y, t, v_k))
+    {
+      is_out = false;
+
+      bool is_in_k = true;
+      t = numeric_limits<double>::infinity();
+      for(int j = 0 ; j < size() ; j++)
+      {
+        is_in_k &= y[j].is_subset(index.codomain(j, v_k[j]));
+        t = min(t, index.t_ub(j, v_k[j])); // end of the common time interval
       }
+
+      is_in |= is_in_k;
     }
 
     if(is_out)
@@ -66,8 +187,9 @@ namespace tubex
     else
     {
       bisect();
-      ((TubePaving*)m_first_subpaving)->compute(precision, x);
-      ((TubePaving*)m_second_subpaving)->compute(precision, x);
+      return true;
     }
+
+    return false;
   }
-}
\ No newline at end of file
+}
@@ -45,7 +45,42 @@ namespace tubex
        */
       void compute(float precision, const TubeVector& x);
 
+      /**
+       * \brief Computes the paving from the tube \f$[\mathbf{x}](\cdot)\f$, using several threads.
+       *
+       * \note Subpavings are distributed over a work-stealing pool of threads.
+       *       The resulting paving is the same as with the sequential computation.
+       *
+       * \param precision precision \f$\epsilon\f$ of the SIVIA approximation
+       * \param x TubeVector \f$[\mathbf{x}](\cdot)\f$
+       * \param nb_threads number of threads, `0` for the number of threads of the global ThreadPool
+       */
+      void compute(float precision, const TubeVector& x, int nb_threads);
+
       /// @}
+
+    protected:
+
+      /**
+       * \brief Index of the slices of a tube vector, built once before the computation
+       *
+       * For each component, a binary tree gathers the hulls of the slices codomains,
+       * the leaves being ordered by slice index. The slices intersecting a box are
+       * then enumerated without walking the tube, nor allocating memory.
+       * The components may have different slicings: the slices of the components
+       * are then considered over the time intervals they have in common.
+       */
+      struct SlicesIndex;
+
+      /**
+       * \brief Tests this paving, and bisects it if no conclusion can be made
+       *
+       * \param precision precision \f$\epsilon\f$ of the SIVIA approximation
+       * \param index index of the slices of \f$[\mathbf{x}](\cdot)\f$
+       * \param v_k buffer of the calling thread, for the indices of the slices of each component
+       * \return `true` if the paving has been bisected
+       */
+      bool compute_node(float precision, const SlicesIndex& index, std::vector<int>& v_k);
   };
 }
 
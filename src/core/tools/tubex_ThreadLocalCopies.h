@@ -0,0 +1,133 @@
+/** 
+ *  \file
+ *  ThreadLocalCopies class
+ * ----------------------------------------------------------------------------
+ *  \date       2020
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2020 Simon Rohou
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#ifndef __TUBEX_THREADLOCALCOPIES_H__
+#define __TUBEX_THREADLOCALCOPIES_H__
+
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <cassert>
+#include <functional>
+
+namespace tubex
+{
+  /**
+   * \class ThreadLocalCopies
+   * \brief Copies of an object with a mutable workspace (such as an ibex::Function),
+   *        one per thread, made on demand
+   *
+   * The first thread requesting the object works on the original one, without any lock.
+   * The other threads get their own copy, cloned at their first request and then cached
+   * until the next reset() or the destruction of this object.
+   */
+  template<typename T>
+  class ThreadLocalCopies
+  {
+    public:
+
+      /**
+       * \brief Creates an empty set of copies
+       */
+      ThreadLocalCopies()
+        : m_owner(std::thread::id())
+      {
+
+      }
+
+      /**
+       * \brief ThreadLocalCopies destructor, deleting the copies
+       */
+      ~ThreadLocalCopies()
+      {
+        clear();
+      }
+
+      ThreadLocalCopies(const ThreadLocalCopies&) = delete;
+      ThreadLocalCopies& operator=(const ThreadLocalCopies&) = delete;
+
+      /**
+       * \brief Sets the original object, and the way to clone it
+       *
+       * Previous copies are deleted. This method is not thread-safe.
+       *
+       * \param original the original object (not owned)
+       * \param clone function allocating a new copy of the original object
+       */
+      void reset(T *original, const std::function<T*()>& clone)
+      {
+        clear();
+        m_original = original;
+        m_clone = clone;
+      }
+
+      /**
+       * \brief Returns the object to be used by the calling thread
+       *
+       * \return the original object for its first user, a copy otherwise
+       */
+      T& get() const
+      {
+        assert(m_original != NULL);
+        const std::thread::id id = std::this_thread::get_id();
+        if(m_owner.load() == id)
+          return *m_original;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        std::thread::id no_owner;
+        if(m_owner.compare_exchange_strong(no_owner, id))
+          return *m_original;
+
+        typename std::map<std::thread::id,T*>::iterator it = m_map_copies.find(id);
+        if(it != m_map_copies.end())
+          return *it->second;
+
+        T *copy = m_clone();
+        m_map_copies[id] = copy;
+        return *copy;
+      }
+
+      /**
+       * \brief Returns the number of copies made so far
+       *
+       * \return the number of copies, the original object excepted
+       */
+      int nb_copies() const
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return (int)m_map_copies.size();
+      }
+
+    protected:
+
+      /**
+       * \brief Deletes the copies, and releases the original object
+       */
+      void clear()
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for(auto& copy : m_map_copies)
+          delete copy.second;
+        m_map_copies.clear();
+        m_owner = std::thread::id();
+      }
+
+      T *m_original = NULL; //!< original object, not owned
+      std::function<T*()> m_clone; //!< allocation of a copy of the original object
+      mutable std::atomic<std::thread::id> m_owner; //!< first thread using the original object
+      mutable std::map<std::thread::id,T*> m_map_copies; //!< copies of the other threads
+      mutable std::mutex m_mutex; //!< lock on the copies
+  };
+}
+
+#endif
@@ -0,0 +1,175 @@
+/** 
+ *  ThreadPool class
+ * ----------------------------------------------------------------------------
+ *  \date       2020
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2020 Simon Rohou
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#include <cstdlib>
+#include <cassert>
+#include "tubex_ThreadPool.h"
+
+using namespace std;
+
+namespace tubex
+{
+  thread_local const ThreadPool *ThreadPool::s_pool = NULL;
+  thread_local int ThreadPool::s_worker_id = -1;
+
+  ThreadPool::ThreadPool(int nb_threads)
+    : m_nb_queued(0), m_next_queue(0)
+  {
+    assert(nb_threads >= 0);
+    start(nb_threads == 0 ? default_nb_threads() : nb_threads);
+  }
+
+  ThreadPool::~ThreadPool()
+  {
+    stop();
+  }
+
+  int ThreadPool::nb_threads() const
+  {
+    return (int)m_v_threads.size();
+  }
+
+  void ThreadPool::set_nb_threads(int nb_threads)
+  {
+    assert(nb_threads >= 0);
+    assert(!is_worker() && "the pool cannot be resized by one of its tasks");
+
+    lock_guard<mutex> resize_lock(m_resize_mutex);
+    stop();
+    start(nb_threads == 0 ? default_nb_threads() : nb_threads);
+  }
+
+  void ThreadPool::submit(const function<void()>& task)
+  {
+    // Tasks submitted by a thread of the pool are kept in its own queue,
+    // the other ones are distributed over the queues, that are not resized meanwhile
+    unique_lock<mutex> resize_lock(m_resize_mutex, defer_lock);
+    if(!is_worker())
+      resize_lock.lock();
+
+    int queue_id = is_worker() ? s_worker_id : (int)(m_next_queue++ % m_v_queues.size());
+
+    {
+      lock_guard<mutex> lock(m_v_queues[queue_id]->mutex);
+      m_v_queues[queue_id]->tasks.push_back(task);
+    }
+
+    {
+      lock_guard<mutex> lock(m_mutex); // no wake-up missed by a thread going idle
+      m_nb_queued++;
+    }
+
+    m_cv.notify_one();
+  }
+
+  bool ThreadPool::is_worker() const
+  {
+    return s_pool == this;
+  }
+
+  ThreadPool& ThreadPool::global()
+  {
+    static ThreadPool pool;
+    return pool;
+  }
+
+  int ThreadPool::default_nb_threads()
+  {
+    const char *env = getenv("TUBEX_NB_THREADS");
+    if(env != NULL && atoi(env) > 0)
+      return atoi(env);
+    return max(1, (int)thread::hardware_concurrency());
+  }
+
+  void ThreadPool::start(int nb_threads)
+  {
+    assert(nb_threads >= 1);
+    assert(m_v_threads.empty());
+
+    m_stop = false;
+    m_v_queues.clear();
+    for(int i = 0 ; i < nb_threads ; i++)
+      m_v_queues.push_back(unique_ptr<Queue>(new Queue()));
+    for(int i = 0 ; i < nb_threads ; i++)
+      m_v_threads.push_back(thread(&ThreadPool::worker_loop, this, i));
+  }
+
+  void ThreadPool::stop()
+  {
+    {
+      lock_guard<mutex> lock(m_mutex);
+      m_stop = true;
+    }
+
+    m_cv.notify_all();
+    for(auto& t : m_v_threads)
+      t.join();
+    m_v_threads.clear();
+  }
+
+  bool ThreadPool::pop_task(int worker_id, function<void()>& task)
+  {
+    const int nb_queues = m_v_queues.size();
+
+    // Own queue: latest task first
+    // Otherwise, stealing the oldest task of another thread
+
+    for(int i = 0 ; i < nb_queues ; i++)
+    {
+      Queue& queue = *m_v_queues[(worker_id + i) % nb_queues];
+      lock_guard<mutex> lock(queue.mutex);
+
+      if(!queue.tasks.empty())
+      {
+        if(i == 0)
+        {
+          task = move(queue.tasks.back());
+          queue.tasks.pop_back();
+        }
+
+        else
+        {
+          task = move(queue.tasks.front());
+          queue.tasks.pop_front();
+        }
+
+        m_nb_queued--;
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  void ThreadPool::worker_loop(int worker_id)
+  {
+    s_pool = this;
+    s_worker_id = worker_id;
+    function<void()> task;
+
+    while(true)
+    {
+      if(pop_task(worker_id, task))
+      {
+        task();
+        task = nullptr;
+        continue;
+      }
+
+      unique_lock<mutex> lock(m_mutex);
+      m_cv.wait(lock, [this] { return m_stop || m_nb_queued > 0; });
+      if(m_stop && m_nb_queued == 0)
+        break; // the queues are empty
+    }
+
+    s_pool = NULL;
+    s_worker_id = -1;
+  }
+}
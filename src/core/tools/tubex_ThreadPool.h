@@ -0,0 +1,229 @@
+/** 
+ *  \file
+ *  ThreadPool class
+ * ----------------------------------------------------------------------------
+ *  \date       2020
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2020 Simon Rohou
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#ifndef __TUBEX_THREADPOOL_H__
+#define __TUBEX_THREADPOOL_H__
+
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <future>
+#include <memory>
+#include <vector>
+#include <utility>
+#include <functional>
+#include <type_traits>
+#include <condition_variable>
+
+namespace tubex
+{
+  /**
+   * \class ThreadPool
+   * \brief Persistent pool of threads, executing tasks with work stealing
+   *
+   * Each thread has its own queue of tasks. A task submitted from a thread of the pool
+   * is pushed in the queue of this thread and executed in last-in first-out order,
+   * while idle threads steal the oldest tasks of the other queues.
+   *
+   * The library uses the global pool, see global(). Its number of threads is given by the
+   * environment variable `TUBEX_NB_THREADS`, or else by the number of available cores,
+   * and can be changed with set_nb_threads().
+   */
+  class ThreadPool
+  {
+    public:
+
+      /**
+       * \brief Creates a pool of threads
+       *
+       * \param nb_threads number of threads, `0` for default_nb_threads()
+       */
+      explicit ThreadPool(int nb_threads = 0);
+
+      /**
+       * \brief ThreadPool destructor, waiting for the tasks already submitted
+       */
+      ~ThreadPool();
+
+      ThreadPool(const ThreadPool&) = delete;
+      ThreadPool& operator=(const ThreadPool&) = delete;
+
+      /**
+       * \brief Returns the number of threads of the pool
+       *
+       * \return the number of threads
+       */
+      int nb_threads() const;
+
+      /**
+       * \brief Changes the number of threads of the pool
+       *
+       * The tasks already submitted are completed beforehand. The tasks submitted
+       * meanwhile by other threads are queued once the new threads are started.
+       *
+       * \note Not to be called from a task of this pool.
+       *
+       * \param nb_threads number of threads, `0` for default_nb_threads()
+       */
+      void set_nb_threads(int nb_threads);
+
+      /**
+       * \brief Submits a task, to be executed by one of the threads
+       *
+       * \param task the task, that should not throw exceptions
+       */
+      void submit(const std::function<void()>& task);
+
+      /**
+       * \brief Executes a function asynchronously
+       *
+       * \param f the function to be executed, without arguments
+       * \return the future result of \f$f\f$, or its exception
+       */
+      template<typename F>
+      std::future<decltype(std::declval<F>()())> async(F&& f)
+      {
+        typedef decltype(std::declval<F>()()) R;
+        std::shared_ptr<std::packaged_task<R()> > task =
+          std::make_shared<std::packaged_task<R()> >(std::forward<F>(f));
+        std::future<R> result = task->get_future();
+        submit([task]() { (*task)(); });
+        return result;
+      }
+
+      /**
+       * \brief Executes a function asynchronously, then a callback on its result
+       *
+       * The callback is executed by the thread that computed the result.
+       *
+       * \note As for submit(), \f$f\f$ and the callback should not throw exceptions:
+       *       an exception escaping from a thread of the pool terminates the program.
+       *       Use async(F&&) otherwise, whose future holds the exception.
+       *
+       * \param f the function to be executed, without arguments and returning a value
+       * \param callback the function called with the result of \f$f\f$
+       */
+      template<typename F, typename C>
+      void async(F&& f, C&& callback)
+      {
+        static_assert(!std::is_void<decltype(std::declval<F>()())>::value,
+          "f must return a value: void functions can call their callback themselves");
+        typename std::decay<F>::type f_copy(std::forward<F>(f));
+        typename std::decay<C>::type callback_copy(std::forward<C>(callback));
+        submit([f_copy, callback_copy]() mutable { callback_copy(f_copy()); });
+      }
+
+      /**
+       * \brief Tests if the calling thread belongs to this pool
+       *
+       * \return true if the calling thread is one of the threads of the pool
+       */
+      bool is_worker() const;
+
+      /**
+       * \brief Returns the global pool, used by the library
+       *
+       * It is created at its first use.
+       *
+       * \return a reference to the global pool
+       */
+      static ThreadPool& global();
+
+      /**
+       * \brief Returns the default number of threads of a pool
+       *
+       * \return the value of the environment variable `TUBEX_NB_THREADS` if defined,
+       *         the number of available cores otherwise
+       */
+      static int default_nb_threads();
+
+    protected:
+
+      /**
+       * \brief Starts the threads
+       *
+       * \param nb_threads number of threads
+       */
+      void start(int nb_threads);
+
+      /**
+       * \brief Waits for the tasks already submitted, and stops the threads
+       */
+      void stop();
+
+      /**
+       * \brief Pops a task from the queue of a thread, or steals one from another queue
+       *
+       * \param worker_id index of the thread
+       * \param task the popped task
+       * \return false if no task is available
+       */
+      bool pop_task(int worker_id, std::function<void()>& task);
+
+      /**
+       * \brief Loop executed by each thread of the pool
+       *
+       * \param worker_id index of the thread
+       */
+      void worker_loop(int worker_id);
+
+      /**
+       * \struct Queue
+       * \brief Tasks of one thread, with their lock
+       */
+      struct Queue
+      {
+        std::deque<std::function<void()> > tasks; //!< tasks, the latest at the back
+        std::mutex mutex; //!< lock on the tasks
+      };
+
+      std::vector<std::unique_ptr<Queue> > m_v_queues; //!< one queue per thread
+      std::vector<std::thread> m_v_threads; //!< threads of the pool
+      std::atomic<int> m_nb_queued; //!< number of tasks waiting in the queues
+      std::atomic<unsigned int> m_next_queue; //!< queue of the next task submitted from outside the pool
+      bool m_stop = false; //!< if true, the threads stop once the queues are empty
+      std::mutex m_mutex; //!< lock for the idle threads
+      std::mutex m_resize_mutex; //!< lock on the queues against a resizing, for the submissions from outside the pool
+      std::condition_variable m_cv; //!< wakes up the idle threads
+
+      static thread_local const ThreadPool *s_pool; //!< pool of the calling thread, if any
+      static thread_local int s_worker_id; //!< index of the calling thread in its pool
+  };
+
+  /**
+   * \brief Executes a function asynchronously, on the global pool of threads
+   *
+   * \param f the function to be executed, without arguments
+   * \return the future result of \f$f\f$, or its exception
+   */
+  template<typename F>
+  std::future<decltype(std::declval<F>()())> async_call(F&& f)
+  {
+    return ThreadPool::global().async(std::forward<F>(f));
+  }
+
+  /**
+   * \brief Executes a function asynchronously on the global pool of threads, then a callback on its result
+   *
+   * \note \f$f\f$ and the callback should not throw exceptions (see ThreadPool::async(F&&,C&&))
+   *
+   * \param f the function to be executed, without arguments and returning a value
+   * \param callback the function called with the result of \f$f\f$
+   */
+  template<typename F, typename C>
+  void async_call(F&& f, C&& callback)
+  {
+    ThreadPool::global().async(std::forward<F>(f), std::forward<C>(callback));
+  }
+}
+
+#endif
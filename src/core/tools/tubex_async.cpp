@@ -0,0 +1,42 @@
+/** 
+ *  Asynchronous variants of heavy operations
+ * ----------------------------------------------------------------------------
+ *  \date       2020
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2020 Simon Rohou
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#include "tubex_async.h"
+
+using namespace std;
+using namespace ibex;
+
+namespace tubex
+{
+  future<Tube> async_primitive(const Tube& x, const Interval& c)
+  {
+    shared_ptr<const Tube> x_copy = make_shared<const Tube>(x);
+    return async_call([x_copy, c]() { return x_copy->primitive(c); });
+  }
+
+  future<TubeVector> async_primitive(const TubeVector& x)
+  {
+    shared_ptr<const TubeVector> x_copy = make_shared<const TubeVector>(x);
+    return async_call([x_copy]() { return x_copy->primitive(); });
+  }
+
+  future<TubeVector> async_primitive(const TubeVector& x, const IntervalVector& c)
+  {
+    shared_ptr<const TubeVector> x_copy = make_shared<const TubeVector>(x);
+    return async_call([x_copy, c]() { return x_copy->primitive(c); });
+  }
+
+  future<TubeVector> async_eval_vector(const TFunction& f, const TubeVector& x)
+  {
+    shared_ptr<const TFunction> f_copy = make_shared<const TFunction>(f);
+    shared_ptr<const TubeVector> x_copy = make_shared<const TubeVector>(x);
+    return async_call([f_copy, x_copy]() { return f_copy->eval_vector(*x_copy); });
+  }
+}
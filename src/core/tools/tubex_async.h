@@ -0,0 +1,129 @@
+/** 
+ *  \file
+ *  Asynchronous variants of heavy operations
+ * ----------------------------------------------------------------------------
+ *  \date       2020
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2020 Simon Rohou
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#ifndef __TUBEX_ASYNC_H__
+#define __TUBEX_ASYNC_H__
+
+#include <tuple>
+#include <memory>
+#include <future>
+#include <utility>
+#include "tubex_ThreadPool.h"
+#include "tubex_Tube.h"
+#include "tubex_TubeVector.h"
+#include "tubex_TFunction.h"
+
+// The following functions are executed on the global ThreadPool.
+// The computations work on copies of their arguments, except for
+// async_contract() that contracts its arguments in place.
+
+namespace tubex
+{
+  /**
+   * \brief Computes asynchronously the primitive of a tube, see Tube::primitive
+   *
+   * \param x the tube, copied before the call
+   * \param c the integration constant, `0` by default
+   * \return the future primitive
+   */
+  std::future<Tube> async_primitive(const Tube& x, const ibex::Interval& c = ibex::Interval(0.));
+
+  /**
+   * \brief Computes asynchronously the primitive of a tube vector, see TubeVector::primitive
+   *
+   * \param x the tube vector, copied before the call
+   * \return the future primitive, with a zero integration constant
+   */
+  std::future<TubeVector> async_primitive(const TubeVector& x);
+
+  /**
+   * \brief Computes asynchronously the primitive of a tube vector, see TubeVector::primitive
+   *
+   * \param x the tube vector, copied before the call
+   * \param c the integration constant
+   * \return the future primitive
+   */
+  std::future<TubeVector> async_primitive(const TubeVector& x, const ibex::IntervalVector& c);
+
+  /**
+   * \brief Evaluates asynchronously a function over a tube vector, see TFunction::eval_vector
+   *
+   * \param f the function, copied before the call
+   * \param x the tube vector, copied before the call
+   * \return the future image of \f$x\f$ by \f$\mathbf{f}\f$
+   */
+  std::future<TubeVector> async_eval_vector(const TFunction& f, const TubeVector& x);
+
+  /**
+   * \struct AsyncIndices
+   * \brief Sequence of indices \f$0,\dots,N-1\f$, as `std::index_sequence` (C++14)
+   */
+  template<std::size_t... I>
+  struct AsyncIndices
+  {
+
+  };
+
+  /**
+   * \struct MakeAsyncIndices
+   * \brief Builds the type AsyncIndices<0,...,N-1> as `MakeAsyncIndices<N>::type`
+   */
+  template<std::size_t N, std::size_t... I>
+  struct MakeAsyncIndices : MakeAsyncIndices<N-1, N-1, I...>
+  {
+
+  };
+
+  template<std::size_t... I>
+  struct MakeAsyncIndices<0, I...>
+  {
+    typedef AsyncIndices<I...> type;
+  };
+
+  /**
+   * \brief Calls `ctc.contract()` with the arguments stored in a tuple
+   *
+   * \param ctc the contractor
+   * \param t_args the arguments of the contraction
+   */
+  template<typename C, typename T, std::size_t... I>
+  void async_contract_apply(C& ctc, T& t_args, AsyncIndices<I...>)
+  {
+    ctc.contract(std::get<I>(t_args)...);
+  }
+
+  /**
+   * \brief Applies asynchronously a contractor, for instance a CtcDeriv or a CtcEval
+   *
+   * Arguments given as lvalues are passed by reference to `ctc.contract()`,
+   * the other ones are copied.
+   *
+   * \note The contractor and the arguments given as lvalues are not copied: they
+   *       must remain alive, and must not be accessed by another thread, until
+   *       the future is ready.
+   *
+   * \param ctc the contractor
+   * \param args the arguments of the contraction
+   * \return a future, ready at the end of the contraction (or holding its exception)
+   */
+  template<typename C, typename... Args>
+  std::future<void> async_contract(C& ctc, Args&&... args)
+  {
+    std::shared_ptr<std::tuple<Args...> > t_args =
+      std::make_shared<std::tuple<Args...> >(std::forward<Args>(args)...);
+
+    return async_call([&ctc, t_args]() {
+      async_contract_apply(ctc, *t_args, typename MakeAsyncIndices<sizeof...(Args)>::type());
+    });
+  }
+}
+
+#endif
@@ -9,6 +9,7 @@
  */
 
 #include <list>
+#include <algorithm>
 #include "tubex_CtcConstell.h"
 
 using namespace std;
@@ -16,18 +17,28 @@ using namespace ibex;
 
 namespace tubex
 {
+  CtcConstell::MapNode::MapNode(int first_, int last_)
+    : box(2, Interval::EMPTY_SET), first(first_), last(last_), children(-1)
+  {
+
+  }
+
   CtcConstell::CtcConstell(const vector<IntervalVector>& map)
-    : Ctc(2), m_map(map)
+    : Ctc(2)
   {
-    // todo: binary tree for logarithmic complexity
+    for(const auto& b : map)
+      if(!b.subvector(0,1).is_empty()) // empty landmarks have no effect
+        m_map.push_back(b.subvector(0,1));
+    create_tree();
   }
 
   CtcConstell::CtcConstell(const list<IntervalVector>& map)
     : Ctc(2)
   {
     for(const auto& b : map)
-      m_map.push_back(b);
-    // todo: binary tree for logarithmic complexity
+      if(!b.subvector(0,1).is_empty()) // empty landmarks have no effect
+        m_map.push_back(b.subvector(0,1));
+    create_tree();
   }
 
   CtcConstell::~CtcConstell()
@@ -40,8 +51,68 @@ namespace tubex
     assert(a.size() == 2);
     IntervalVector union_result(2, Interval::EMPTY_SET);
 
-    for(const auto mj : m_map)
-      union_result |= a & mj.subvector(0,1);
+    if(!m_tree.empty())
+      contract_node(0, a, union_result);
     a = union_result;
   }
-}
\ No newline at end of file
+
+  void CtcConstell::create_tree()
+  {
+    // Binary tree for logarithmic complexity
+    m_tree.clear();
+    if(!m_map.empty())
+    {
+      m_tree.push_back(MapNode(0, m_map.size()));
+      build_tree(0);
+    }
+  }
+
+  void CtcConstell::build_tree(int node_id)
+  {
+    int first = m_tree[node_id].first, last = m_tree[node_id].last;
+
+    IntervalVector hull(2, Interval::EMPTY_SET);
+    for(int i = first ; i < last ; i++)
+      hull |= m_map[i];
+    m_tree[node_id].box = hull;
+
+    if(last - first <= s_max_leaf_size)
+      return; // leaf
+
+    int dim = hull[0].diam() >= hull[1].diam() ? 0 : 1;
+    int mid = first + (last - first) / 2;
+    nth_element(m_map.begin() + first, m_map.begin() + mid, m_map.begin() + last,
+      [dim](const IntervalVector& b1, const IntervalVector& b2) { return b1[dim].mid() < b2[dim].mid(); });
+
+    int children = m_tree.size();
+    m_tree[node_id].children = children;
+    m_tree.push_back(MapNode(first, mid));
+    m_tree.push_back(MapNode(mid, last));
+    build_tree(children);
+    build_tree(children + 1);
+  }
+
+  void CtcConstell::contract_node(int node_id, const IntervalVector& a, IntervalVector& union_result) const
+  {
+    const MapNode& node = m_tree[node_id];
+
+    if(!a.intersects(node.box) || a.is_subset(union_result))
+      return; // nothing more to be added
+
+    if(node.box.is_subset(a)) // all the landmarks are kept
+      union_result |= node.box;
+
+    else if(node.children == -1)
+    {
+      for(int i = node.first ; i < node.last ; i++)
+        if(a.intersects(m_map[i]))
+          union_result |= a & m_map[i];
+    }
+
+    else
+    {
+      contract_node(node.children, a, union_result);
+      contract_node(node.children + 1, a, union_result);
+    }
+  }
+}
@@ -32,7 +32,49 @@ namespace tubex
 
     protected:
 
-      std::vector<ibex::IntervalVector> m_map;
+      /**
+       * \brief Node of the bounding-volume hierarchy built over the landmarks
+       */
+      struct MapNode
+      {
+        MapNode(int first_, int last_);
+
+        ibex::IntervalVector box; //!< hull of the landmarks of this node
+        int first, last; //!< range [first,last[ of the landmarks of this node in m_map
+        int children; //!< index of the first child node (the second one follows), -1 for a leaf
+      };
+
+      /**
+       * \brief Creates the bounding-volume hierarchy over the landmarks of m_map
+       */
+      void create_tree();
+
+      /**
+       * \brief Builds the hierarchy below the node, by recursive median
+       *        splits of its landmarks along the largest dimension
+       *
+       * \note The landmarks of m_map are reordered accordingly.
+       *
+       * \param node_id index of the node in m_tree
+       */
+      void build_tree(int node_id);
+
+      /**
+       * \brief Computes the union of the intersections between the box
+       *        and the landmarks of the node
+       *
+       * \note Subtrees disjoint from the box, or entirely enclosed in it,
+       *       are handled without visiting their landmarks.
+       *
+       * \param node_id index of the node in m_tree
+       * \param a the box to be contracted
+       * \param union_result the union to be updated
+       */
+      void contract_node(int node_id, const ibex::IntervalVector& a, ibex::IntervalVector& union_result) const;
+
+      std::vector<ibex::IntervalVector> m_map; //!< 2d landmarks, ordered by the tree
+      std::vector<MapNode> m_tree; //!< hierarchy over the landmarks, the root being m_tree[0]
+      static const int s_max_leaf_size = 8; //!< maximal number of landmarks in a leaf
   };
 }
 
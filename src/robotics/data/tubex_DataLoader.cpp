@@ -9,16 +9,115 @@
  */
 
 #include <time.h>
+#include <cstring>
+#include <cstdlib>
 #include <algorithm>
 #include "tubex_DataLoader.h"
 #include "tubex_Exception.h"
 #include "tubex_Tools.h"
 
+#if defined(__unix__) || defined(__APPLE__)
+  #include <fcntl.h>
+  #include <unistd.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #define DATA_FILE_MMAP
+#endif
+
+#if __cplusplus >= 201703L && defined(__has_include)
+  #if __has_include(<charconv>)
+    #include <charconv>
+  #endif
+#endif
+
+#if !defined(__cpp_lib_to_chars) || __cpp_lib_to_chars < 201611L
+  #include <clocale>
+  #if defined(__APPLE__)
+    #include <xlocale.h>
+  #endif
+#endif
+
 #define DATA_FILE_EXTENSION ".tubex"
 
 using namespace std;
 using namespace ibex;
 
+namespace
+{
+  inline bool is_blank(char c)
+  {
+    return c == ' ' || c == '\t' || c == '\r';
+  }
+
+  #if !defined(__cpp_lib_to_chars) || __cpp_lib_to_chars < 201611L
+
+    // Parsing in the "C" locale: the data files do not depend on the
+    // locale of the program (decimal point)
+
+    #if defined(_WIN32)
+
+      inline double strtod_c(const char *s, char **s_end)
+      {
+        static const _locale_t c_locale = _create_locale(LC_NUMERIC, "C");
+        return _strtod_l(s, s_end, c_locale);
+      }
+
+    #else
+
+      inline double strtod_c(const char *s, char **s_end)
+      {
+        static const locale_t c_locale = newlocale(LC_NUMERIC_MASK, "C", (locale_t)0);
+        return strtod_l(s, s_end, c_locale);
+      }
+
+    #endif
+
+  #endif
+
+  // Parses a double in [p,end), p being moved after the value
+  inline bool parse_double(const char *&p, const char *end, double& value)
+  {
+    if(p < end && *p == '+')
+      p++;
+
+    #if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+      from_chars_result r = from_chars(p, end, value);
+      if(r.ec != errc())
+        return false;
+      p = r.ptr;
+      return true;
+    #else
+      // strtod needs a null-terminated string: the token is copied,
+      // in a small buffer or, for long tokens, in a string
+      size_t n = 0;
+      while(p + n < end && !is_blank(p[n]))
+        n++;
+
+      char buffer[64];
+      string long_token;
+      char *token = buffer;
+      if(n < sizeof(buffer))
+      {
+        memcpy(buffer, p, n);
+        buffer[n] = '\0';
+      }
+
+      else
+      {
+        long_token.assign(p, n);
+        token = &long_token[0];
+      }
+
+      char *token_end;
+      value = strtod_c(token, &token_end);
+      if(token_end == token)
+        return false;
+      p += token_end - token;
+      return true;
+    #endif
+  }
+}
+
 namespace tubex
 {
   DataLoader::DataLoader()
@@ -29,16 +128,14 @@ namespace tubex
   DataLoader::DataLoader(const string& file_path)
     : m_file_path(file_path)
   {
-    m_datafile = new ifstream();
-    m_datafile->open(file_path.c_str(), std::ios_base::out);
-    if(!m_datafile->is_open())
+    // The file is read at loading time, its existence is checked beforehand
+    if(!ifstream(file_path).is_open())
       throw Exception("DataLoader constructor", "unable to load data file");
   }
 
   DataLoader::~DataLoader()
   {
-    if(m_datafile != NULL)
-      delete m_datafile;
+
   }
 
   void DataLoader::serialize_data(const TubeVector& x, const TrajectoryVector& traj) const
@@ -64,6 +161,115 @@ namespace tubex
     x = new TubeVector(m_file_path + DATA_FILE_EXTENSION, traj);
   }
 
+  vector<vector<double> > DataLoader::read_columns(const string& file_path, int nb_columns, int nb_skipped_lines, int end_line)
+  {
+    assert(nb_columns > 0);
+    assert(nb_skipped_lines >= 0);
+    assert(end_line == -1 || end_line > 0);
+
+    // Accessing the content of the file
+
+    const char *data = NULL;
+    size_t size = 0;
+
+    #ifdef DATA_FILE_MMAP
+
+      int fd = open(file_path.c_str(), O_RDONLY);
+      struct stat st;
+      if(fd < 0 || fstat(fd, &st) != 0)
+      {
+        if(fd >= 0) close(fd);
+        throw Exception("DataLoader::read_columns", "unable to load data file");
+      }
+
+      size = st.st_size;
+      if(size > 0)
+      {
+        void *mapping = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(mapping == MAP_FAILED)
+        {
+          close(fd);
+          throw Exception("DataLoader::read_columns", "unable to map data file");
+        }
+
+        madvise(mapping, size, MADV_SEQUENTIAL);
+        data = (const char*)mapping;
+      }
+
+      close(fd); // the mapping remains valid
+
+    #else
+
+      ifstream file(file_path, ios::in | ios::binary);
+      if(!file.is_open())
+        throw Exception("DataLoader::read_columns", "unable to load data file");
+      string content((istreambuf_iterator<char>(file)), istreambuf_iterator<char>());
+      data = content.data();
+      size = content.size();
+
+    #endif
+
+    const char *end = data + size;
+
+    // Reserving the columns, from the number of lines
+
+    size_t nb_lines = 0;
+    for(const char *p = data ; p < end && (p = (const char*)memchr(p, '\n', end - p)) != NULL ; p++)
+      nb_lines++;
+
+    size_t nb_read_lines = nb_lines + 1; // the last line may not end with a newline
+    if(end_line != -1)
+      nb_read_lines = min(nb_read_lines, (size_t)end_line - 1);
+    size_t nb_rows_max = nb_read_lines > (size_t)nb_skipped_lines ? nb_read_lines - nb_skipped_lines : 0;
+
+    vector<vector<double> > v_columns(nb_columns);
+    for(auto& column : v_columns)
+      column.reserve(nb_rows_max);
+
+    // Parsing the lines in place
+
+    int line = 0;
+    const char *p = data;
+
+    while(p < end && (end_line == -1 || line + 1 < end_line))
+    {
+      const char *eol = (const char*)memchr(p, '\n', end - p);
+      if(eol == NULL)
+        eol = end;
+      line++;
+
+      while(p < eol && is_blank(*p)) p++;
+
+      if(line > nb_skipped_lines && p < eol) // not a header or blank line
+      {
+        for(int j = 0 ; j < nb_columns ; j++)
+        {
+          double value;
+          if(!parse_double(p, eol, value))
+          {
+            #ifdef DATA_FILE_MMAP
+              munmap((void*)data, size);
+            #endif
+            throw Exception("DataLoader::read_columns",
+                            "fail loading data at line " + to_string(line) + " of " + file_path);
+          }
+
+          v_columns[j].push_back(value);
+          while(p < eol && is_blank(*p)) p++;
+        }
+      }
+
+      p = eol + 1;
+    }
+
+    #ifdef DATA_FILE_MMAP
+      if(data != NULL)
+        munmap((void*)data, size);
+    #endif
+
+    return v_columns;
+  }
+
   vector<Beacon> DataLoader::generate_landmarks(const IntervalVector& map_box, int nb_landmarks)
   {
     assert(map_box.size() == 2);
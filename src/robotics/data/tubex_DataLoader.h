@@ -83,8 +83,25 @@ namespace tubex
 
     protected:
 
+      /**
+       * \brief Reads a text file of numerical values, arranged in columns
+       *
+       * The file is memory-mapped when possible and parsed in place: values are
+       * stored column-wise, for a bulk construction of the trajectories.
+       * Blank lines are ignored.
+       * Numbers are read in the "C" locale, whatever the locale of the program.
+       *
+       * \param file_path path of the file
+       * \param nb_columns number of values to read on each line (other values are ignored)
+       * \param nb_skipped_lines number of header lines to skip
+       * \param end_line number of the line (from 1) at which the reading stops,
+       *        this line being excluded (-1 for the whole file)
+       * \return the values, in nb_columns vectors
+       */
+      static std::vector<std::vector<double> > read_columns(const std::string& file_path,
+                     int nb_columns, int nb_skipped_lines = 0, int end_line = -1);
+
       std::string m_file_path;
-      std::ifstream *m_datafile = NULL;
   };
 }
 
@@ -20,11 +20,17 @@ using namespace ibex;
 namespace tubex
 {
   DataLoaderRedermor::DataLoaderRedermor(const string& file_path)
-    : DataLoader(file_path)
+    : DataLoader(file_path), m_end_line(60000) // data from line 46 to 59999 of the file
   {
 
   }
 
+  void DataLoaderRedermor::set_end_line(int end_line)
+  {
+    assert(end_line == -1 || end_line > 0);
+    m_end_line = end_line;
+  }
+
   void DataLoaderRedermor::load_data(TubeVector *&x, TrajectoryVector *&truth, float timestep, const Interval& tdomain)
   {
     assert(tdomain == Interval::ALL_REALS || DynamicalItem::valid_tdomain(tdomain));
@@ -36,48 +42,34 @@ namespace tubex
     
     else // loading data from file
     {
-      if(!m_datafile->is_open())
-        throw Exception("DataLoaderRedermor::load_data", "data file not already open");
-
-      int i = 0;
-      string line;
-      TrajectoryVector traj_data_x(10), traj_data_dx(10);
-      truth = new TrajectoryVector(6);
-
-      while(getline(*m_datafile, line))
-      {
-        i ++;
-        if(i < 46) continue; // accessing data
-        if(i == 60000) break; // end of data
-
-        double t;
-        Vector y(10), dy(10);
-
-        istringstream iss(line);
-        if(!(iss >> t
-                 >> y[0] >> dy[0]   // phi
-                 >> y[1] >> dy[1]   // theta
-                 >> y[2] >> dy[2]   // psi
-                 >> y[3] >> dy[3]   // vx
-                 >> y[4] >> dy[4]   // vy
-                 >> y[5] >> dy[5]   // vz
-                 >> y[6] >> dy[6]   // depth
-                 >> y[7] >> dy[7]   // alt
-                 >> y[8] >> dy[8]   // x
-                 >> y[9] >> dy[9])) // y
-          throw Exception("DataLoaderRedermor::load_data", "fail loading data");
-
-        // Trajectory used for velocities evaluations:
-        traj_data_x.set(y, t);
-        traj_data_dx.set(dy, t);
-
-        // Trajectory used as ground truth:
-        Vector truth_vector(6);
-        truth_vector.put(0, y.subvector(8,9)); // position
-        truth_vector[2] = y[6]; // depth
-        truth_vector.put(3, Vector(3, 0.)); // unknown velocities
-        truth->set(truth_vector, t);
-      }
+      // Columns: t, then the values and uncertainties of
+      // phi, theta, psi, vx, vy, vz, depth, alt, x, y
+      vector<vector<double> > v_columns = read_columns(m_file_path, 21, 45, m_end_line);
+      if(v_columns[0].empty())
+        throw Exception("DataLoaderRedermor::load_data", "no data in file");
+
+      // Column-wise construction of the trajectories
+      vector<map<double,double> > v_x(10), v_dx(10), v_truth(6);
+      const vector<double>& v_t = v_columns[0];
+
+      for(int j = 0 ; j < 10 ; j++)
+        for(size_t k = 0 ; k < v_t.size() ; k++)
+        {
+          // Sorted times: constant-time insertions at the end of the maps,
+          // a value overwriting a previous one of same time
+          v_x[j].emplace_hint(v_x[j].end(), v_t[k], 0.)->second = v_columns[1+2*j][k];
+          v_dx[j].emplace_hint(v_dx[j].end(), v_t[k], 0.)->second = v_columns[2+2*j][k];
+        }
+
+      TrajectoryVector traj_data_x(v_x), traj_data_dx(v_dx);
+
+      // Trajectory used as ground truth:
+      v_truth[0] = v_x[8]; v_truth[1] = v_x[9]; // position
+      v_truth[2] = v_x[6]; // depth
+      for(int j = 3 ; j < 6 ; j++) // unknown velocities
+        for(const auto& it : v_x[0])
+          v_truth[j].emplace_hint(v_truth[j].end(), it.first, 0.);
+      truth = new TrajectoryVector(v_truth);
 
       // Data from sensors with uncertainties:
       x = new TubeVector(traj_data_x, timestep); // state vector
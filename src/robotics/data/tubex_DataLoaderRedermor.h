@@ -29,8 +29,19 @@ namespace tubex
       std::vector<Beacon> get_beacons() const;
       std::map<int,std::vector<ibex::IntervalVector> > get_observations() const;
 
+      /**
+       * \brief Sets the line of the file at which the loading of the data stops
+       *
+       * By default, the data are loaded up to the line 60000 of the file, excluded.
+       *
+       * \param end_line number of the line (from 1), excluded (-1 for the whole file)
+       */
+      void set_end_line(int end_line);
+
     protected:
 
+      int m_end_line; //!< line at which the loading stops, excluded (-1: whole file)
+
   };
 }
 
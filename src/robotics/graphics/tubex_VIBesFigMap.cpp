@@ -51,6 +51,8 @@ namespace tubex
 
   void VIBesFigMap::show()
   {
+    vibes::Batch batch; // messages sent at once, at the end of the method
+
     typename map<const TubeVector*,FigMapTubeParams>::const_iterator it_tubes;
     for(it_tubes = m_map_tubes.begin(); it_tubes != m_map_tubes.end(); it_tubes++)
       m_view_box |= draw_tube(it_tubes->first);
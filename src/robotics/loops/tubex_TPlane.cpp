@@ -9,6 +9,7 @@
  */
 
 #include "tubex_TPlane.h"
+#include "tubex_ThreadPool.h"
 
 using namespace std;
 using namespace ibex;
@@ -26,6 +27,12 @@ namespace tubex
     compute_detections(precision, p, v, true);
   }
 
+  void TPlane::set_nb_threads(int nb_threads)
+  {
+    assert(nb_threads >= 0);
+    m_nb_threads = nb_threads;
+  }
+
   void TPlane::compute_detections(float precision, const TubeVector& p, const TubeVector& v, bool extract_subsets)
   {
     assert(precision > 0.);
@@ -35,78 +42,101 @@ namespace tubex
     if(m_box.is_unbounded())
       m_box = IntervalVector(2, p.tdomain()); // initializing
     m_precision = precision;
-    
-    if(value() == SetValue::OUT)
-      return;
 
-    else if(!is_leaf())
-    {
-      ((TPlane*)m_first_subpaving)->compute_detections(precision, p, v, false);
-      ((TPlane*)m_second_subpaving)->compute_detections(precision, p, v, false);
-    }
+    int nb_threads = m_nb_threads;
+    if(nb_threads == 0)
+      nb_threads = ThreadPool::global().nb_threads();
 
-    else
-    {
-      const Interval t1 = m_box[0], t2 = m_box[1];
-      const IntervalVector box_neg_reals(2, Interval::NEG_REALS);
-      const IntervalVector box_pos_reals(2, Interval::POS_REALS);
-
-      // Based on derivative information
-      
-        const pair<IntervalVector, IntervalVector> partial_integ = v.partial_integral(t1, t2);
-        const IntervalVector integ = IntervalVector(partial_integ.first.lb()) | partial_integ.second.ub();
-
-        bool derivative_out = Interval::POS_REALS.is_strict_superset(t1 - t2)
-                           || !integ.interior_contains(Vector(2, 0.)) 
-                           || !v(t1 | t2).interior_contains(Vector(2, 0.));
-
-        bool derivative_in = Interval::NEG_REALS.is_strict_superset(t1 - t2)
-                          && box_neg_reals.is_strict_superset(partial_integ.first)
-                          && box_pos_reals.is_strict_superset(partial_integ.second);
-      
-      // Based on primitive information (<=> kernel)
-
-        pair<IntervalVector,IntervalVector> uy1 = p.eval(t1);
-        pair<IntervalVector,IntervalVector> uy2 = p.eval(t2);
-        pair<IntervalVector,IntervalVector> enc_bounds = make_pair(
-          IntervalVector(uy1.first.lb()  - uy2.second.ub()) | (uy1.first.ub()  - uy2.second.lb()),
-          IntervalVector(uy1.second.lb() - uy2.first.ub())  | (uy1.second.ub() - uy2.first.lb()));
-
-        bool primitive_out = Interval::POS_REALS.is_strict_superset(t1 - t2)
-                             || Interval::POS_REALS.is_strict_superset(enc_bounds.first[0])
-                             || Interval::POS_REALS.is_strict_superset(enc_bounds.first[1])
-                             || Interval::NEG_REALS.is_strict_superset(enc_bounds.second[0])
-                             || Interval::NEG_REALS.is_strict_superset(enc_bounds.second[1]);
-
-        bool primitive_in = Interval::NEG_REALS.is_strict_superset(t1 - t2)
-                             && Interval::NEG_REALS.is_strict_superset(enc_bounds.first[0])
-                             && Interval::NEG_REALS.is_strict_superset(enc_bounds.first[1])
-                             && Interval::POS_REALS.is_strict_superset(enc_bounds.second[0])
-                             && Interval::POS_REALS.is_strict_superset(enc_bounds.second[1]);
-
-      // Conclusion
-
-        if(derivative_out || primitive_out)
-          set_value(SetValue::OUT);
-
-        else if(derivative_in && primitive_in)
-          set_value(SetValue::IN);
-
-        else if(max(t1.diam(), t2.diam()) < precision)
-          set_value(SetValue::MAYBE);
-
-        else
-        {
-          bisect();
-          ((TPlane*)m_first_subpaving)->compute_detections(precision, p, v, false);
-          ((TPlane*)m_second_subpaving)->compute_detections(precision, p, v, false);
-        }
-    }
+    // Synthesis trees: O(log n) evaluations and partial integrals
+
+      TubeVector p_synth(p), v_synth(v);
+      p_synth.enable_synthesis();
+      v_synth.enable_synthesis();
+
+      // The trees are lazily updated: they are completely
+      // updated here, before being read by several threads
+      for(int i = 0 ; i < 2 ; i++)
+      {
+        p_synth[i].eval(p.tdomain());
+        v_synth[i].eval(v.tdomain());
+        v_synth[i].partial_integral(v.tdomain());
+      }
+
+    compute_in_parallel([&](Paving *node, int)
+      {
+        return compute_node(node, precision, p_synth, v_synth);
+      },
+      nb_threads);
 
     if(extract_subsets)
       m_v_detected_loops = get_connected_subsets();
   }
 
+  bool TPlane::compute_node(Paving *node, float precision, const TubeVector& p, const TubeVector& v)
+  {
+    if(node->value() == SetValue::OUT)
+      return false;
+
+    else if(!node->is_leaf())
+      return true;
+
+    const Interval t1 = node->box()[0], t2 = node->box()[1];
+    const IntervalVector box_neg_reals(2, Interval::NEG_REALS);
+    const IntervalVector box_pos_reals(2, Interval::POS_REALS);
+
+    // Based on derivative information
+    
+      const pair<IntervalVector, IntervalVector> partial_integ = v.partial_integral(t1, t2);
+      const IntervalVector integ = IntervalVector(partial_integ.first.lb()) | partial_integ.second.ub();
+
+      bool derivative_out = Interval::POS_REALS.is_strict_superset(t1 - t2)
+                         || !integ.interior_contains(Vector(2, 0.)) 
+                         || !v(t1 | t2).interior_contains(Vector(2, 0.));
+
+      bool derivative_in = Interval::NEG_REALS.is_strict_superset(t1 - t2)
+                        && box_neg_reals.is_strict_superset(partial_integ.first)
+                        && box_pos_reals.is_strict_superset(partial_integ.second);
+    
+    // Based on primitive information (<=> kernel)
+
+      pair<IntervalVector,IntervalVector> uy1 = p.eval(t1);
+      pair<IntervalVector,IntervalVector> uy2 = p.eval(t2);
+      pair<IntervalVector,IntervalVector> enc_bounds = make_pair(
+        IntervalVector(uy1.first.lb()  - uy2.second.ub()) | (uy1.first.ub()  - uy2.second.lb()),
+        IntervalVector(uy1.second.lb() - uy2.first.ub())  | (uy1.second.ub() - uy2.first.lb()));
+
+      bool primitive_out = Interval::POS_REALS.is_strict_superset(t1 - t2)
+                           || Interval::POS_REALS.is_strict_superset(enc_bounds.first[0])
+                           || Interval::POS_REALS.is_strict_superset(enc_bounds.first[1])
+                           || Interval::NEG_REALS.is_strict_superset(enc_bounds.second[0])
+                           || Interval::NEG_REALS.is_strict_superset(enc_bounds.second[1]);
+
+      bool primitive_in = Interval::NEG_REALS.is_strict_superset(t1 - t2)
+                           && Interval::NEG_REALS.is_strict_superset(enc_bounds.first[0])
+                           && Interval::NEG_REALS.is_strict_superset(enc_bounds.first[1])
+                           && Interval::POS_REALS.is_strict_superset(enc_bounds.second[0])
+                           && Interval::POS_REALS.is_strict_superset(enc_bounds.second[1]);
+
+    // Conclusion
+
+      if(derivative_out || primitive_out)
+        node->set_value(SetValue::OUT);
+
+      else if(derivative_in && primitive_in)
+        node->set_value(SetValue::IN);
+
+      else if(max(t1.diam(), t2.diam()) < precision)
+        node->set_value(SetValue::MAYBE);
+
+      else
+      {
+        node->bisect();
+        return true;
+      }
+
+    return false;
+  }
+
   void TPlane::compute_proofs(IntervalVector (*f)(const IntervalVector& b))
   {
     for(size_t i = 0 ; i < m_v_detected_loops.size() ; i++)
@@ -59,6 +59,20 @@ namespace tubex
        */
       void compute_detections(float precision, const TubeVector& p, const TubeVector& v);
 
+      /**
+       * \brief Sets the number of threads used by compute_detections()
+       *
+       * \note The evaluations and partial integrals needed by each subpaving are
+       *       computed in logarithmic time with respect to the number of slices,
+       *       on copies of the tubes equipped with synthesis trees. With several
+       *       threads, subpavings are distributed over a work-stealing pool of threads.
+       *       The resulting tplane is the same as with one thread.
+       *
+       * \param nb_threads number of threads, `0` for the number of threads of the global ThreadPool
+       *                   (by default, the computation is made in the calling thread)
+       */
+      void set_nb_threads(int nb_threads);
+
       /**
        * \brief Tries to prove the existence of loops in each detection set
        *
@@ -117,11 +131,9 @@ namespace tubex
     protected:
 
       /**
-       * \brief Recursive computation of the tplane, from the tube of positions \f$[\mathbf{p}](\cdot)\f$
+       * \brief Computes this tplane as a subpaving, from the tube of positions \f$[\mathbf{p}](\cdot)\f$
        *        and the tube of velocities \f$[\mathbf{v}](\cdot)\f$.
        *
-       * \note This method is used as recursive algorithm.
-       *
        * \param precision precision \f$\epsilon\f$ of the SIVIA approximation
        * \param p 2d TubeVector \f$[\mathbf{p}](\cdot)\f$ for positions
        * \param v 2d TubeVector \f$[\mathbf{v}](\cdot)\f$ for velocities
@@ -129,7 +141,22 @@ namespace tubex
        */
       void compute_detections(float precision, const TubeVector& p, const TubeVector& v, bool extract_subsets);
 
+      /**
+       * \brief Tests a subpaving of the tplane, and bisects it if no conclusion can be made
+       *
+       * \note The subpavings resulting from a bisection are Paving objects:
+       *       only the members of the Paving class are accessed.
+       *
+       * \param node subpaving to be tested
+       * \param precision precision \f$\epsilon\f$ of the SIVIA approximation
+       * \param p 2d TubeVector \f$[\mathbf{p}](\cdot)\f$ for positions
+       * \param v 2d TubeVector \f$[\mathbf{v}](\cdot)\f$ for velocities
+       * \return `true` if the subpavings of the node have to be computed
+       */
+      static bool compute_node(Paving *node, float precision, const TubeVector& p, const TubeVector& v);
+
       float m_precision = 0.; //!< precision of the SIVIA algorithm, used later on in traj_loops_summary()
+      int m_nb_threads = 1; //!< number of threads of the computation of the detections
       std::vector<ConnectedSubset> m_v_detected_loops; //!< set of loops detections
       std::vector<ConnectedSubset> m_v_proven_loops; //!< set of loops proofs
   };
@@ -0,0 +1,96 @@
+/** 
+ *  Benchmark: CtcConstell
+ * ----------------------------------------------------------------------------
+ *
+ *  \brief      Compares the contractor CtcConstell (tree of landmarks)
+ *              with a linear scan of the map, on random constellations.
+ *              Usage: tubex-bench-constell [nb_landmarks] [nb_queries]
+ *
+ *  \date       2020
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2020 Simon Rohou
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#include <cstdlib>
+#include <chrono>
+#include <iostream>
+#include <vector>
+#include "tubex_CtcConstell.h"
+
+using namespace std;
+using namespace ibex;
+using namespace tubex;
+
+double rand_double(double lb, double ub)
+{
+  return lb + (ub - lb) * ((double)rand() / RAND_MAX);
+}
+
+IntervalVector rand_box(double size_max, double map_size)
+{
+  IntervalVector b(2);
+  for(int i = 0 ; i < 2 ; i++)
+  {
+    double lb = rand_double(0., map_size);
+    b[i] = Interval(lb, lb + rand_double(0., size_max));
+  }
+  return b;
+}
+
+void linear_scan(const vector<IntervalVector>& map, IntervalVector& a)
+{
+  // Former implementation of CtcConstell::contract()
+  IntervalVector union_result(2, Interval::EMPTY_SET);
+  for(const auto& mj : map)
+    union_result |= a & mj;
+  a = union_result;
+}
+
+int main(int argc, char** argv)
+{
+  int nb_landmarks = argc > 1 ? atoi(argv[1]) : 100000;
+  int nb_queries = argc > 2 ? atoi(argv[2]) : 10000;
+  double map_size = 1000.;
+
+  srand(42);
+
+  vector<IntervalVector> map, queries;
+  for(int i = 0 ; i < nb_landmarks ; i++)
+    map.push_back(rand_box(1., map_size));
+  for(int i = 0 ; i < nb_queries ; i++)
+    queries.push_back(rand_box(50., map_size));
+
+  auto t0 = chrono::steady_clock::now();
+  CtcConstell ctc_constell(map);
+  auto t1 = chrono::steady_clock::now();
+
+  vector<IntervalVector> results_tree(queries), results_scan(queries);
+
+  for(auto& a : results_tree)
+    ctc_constell.contract(a);
+  auto t2 = chrono::steady_clock::now();
+
+  for(auto& a : results_scan)
+    linear_scan(map, a);
+  auto t3 = chrono::steady_clock::now();
+
+  int nb_errors = 0;
+  for(int i = 0 ; i < nb_queries ; i++)
+    if(results_tree[i] != results_scan[i])
+      nb_errors++;
+
+  double build_ms = chrono::duration<double,milli>(t1 - t0).count();
+  double tree_ns = chrono::duration<double,nano>(t2 - t1).count() / nb_queries;
+  double scan_ns = chrono::duration<double,nano>(t3 - t2).count() / nb_queries;
+
+  cout << "landmarks: " << nb_landmarks << ", queries: " << nb_queries << endl;
+  cout << "  tree construction: " << build_ms << " ms" << endl;
+  cout << "  tree:        " << tree_ns << " ns/query" << endl;
+  cout << "  linear scan: " << scan_ns << " ns/query" << endl;
+  cout << "  speedup:     " << scan_ns / tree_ns << endl;
+  cout << "  errors:      " << nb_errors << endl;
+
+  return nb_errors == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,282 @@
+/** 
+ *  Benchmark tools
+ * ----------------------------------------------------------------------------
+ *  \date       2020
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2020 Simon Rohou
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#include <atomic>
+#include <cstdlib>
+#include <cstddef>
+#include <ctime>
+#include <new>
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include "bench_tools.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+  #include <sys/resource.h>
+#endif
+
+#ifndef TUBEX_BENCH_VERSION
+  #define TUBEX_BENCH_VERSION "unknown"
+#endif
+
+using namespace std;
+
+// Heap allocations are counted by replacing the global operators new/delete:
+// each block is preceded by a header storing its size.
+// Class allocators recycling their blocks (Paving nodes) are not seen.
+
+namespace
+{
+  atomic<size_t> g_nb_allocs(0), g_allocated_bytes(0), g_current_bytes(0), g_peak_bytes(0);
+  const size_t HEADER_SIZE = alignof(max_align_t);
+  const char *ALLOCS_NOTE = "nodes of pavings reused from the free lists of Paving::operator new are not counted";
+
+  void* counted_malloc(size_t size)
+  {
+    char *p = (char*)malloc(size + HEADER_SIZE);
+    if(p == NULL)
+      return NULL;
+
+    *(size_t*)p = size;
+    g_nb_allocs++;
+    g_allocated_bytes += size;
+
+    size_t current = (g_current_bytes += size);
+    size_t peak = g_peak_bytes.load();
+    while(current > peak && !g_peak_bytes.compare_exchange_weak(peak, current));
+
+    return p + HEADER_SIZE;
+  }
+
+  void counted_free(void *ptr)
+  {
+    if(ptr == NULL)
+      return;
+
+    char *p = (char*)ptr - HEADER_SIZE;
+    g_current_bytes -= *(size_t*)p;
+    free(p);
+  }
+}
+
+void* operator new(size_t size)
+{
+  void *p = counted_malloc(size);
+  if(p == NULL) throw bad_alloc();
+  return p;
+}
+
+void* operator new[](size_t size)
+{
+  void *p = counted_malloc(size);
+  if(p == NULL) throw bad_alloc();
+  return p;
+}
+
+void* operator new(size_t size, const nothrow_t&) noexcept { return counted_malloc(size); }
+void* operator new[](size_t size, const nothrow_t&) noexcept { return counted_malloc(size); }
+void operator delete(void *p) noexcept { counted_free(p); }
+void operator delete[](void *p) noexcept { counted_free(p); }
+void operator delete(void *p, const nothrow_t&) noexcept { counted_free(p); }
+void operator delete[](void *p, const nothrow_t&) noexcept { counted_free(p); }
+#ifdef __cpp_sized_deallocation
+void operator delete(void *p, size_t) noexcept { counted_free(p); }
+void operator delete[](void *p, size_t) noexcept { counted_free(p); }
+#endif
+
+namespace bench
+{
+  HeapStats heap_stats()
+  {
+    return { g_nb_allocs.load(), g_allocated_bytes.load(), g_current_bytes.load(), g_peak_bytes.load() };
+  }
+
+  void reset_heap_peak()
+  {
+    g_peak_bytes = g_current_bytes.load();
+  }
+
+  long peak_rss_kb()
+  {
+    #if defined(__APPLE__)
+      struct rusage usage;
+      return getrusage(RUSAGE_SELF, &usage) == 0 ? usage.ru_maxrss / 1024 : -1; // bytes
+    #elif defined(__unix__)
+      struct rusage usage;
+      return getrusage(RUSAGE_SELF, &usage) == 0 ? usage.ru_maxrss : -1; // kB
+    #else
+      return -1;
+    #endif
+  }
+
+  void Measure::start()
+  {
+    m_heap0 = heap_stats();
+    reset_heap_peak();
+    m_t0 = chrono::steady_clock::now();
+  }
+
+  void Measure::stop()
+  {
+    auto t1 = chrono::steady_clock::now();
+    HeapStats heap = heap_stats();
+    m_ns = chrono::duration<double,nano>(t1 - m_t0).count();
+    m_nb_allocs = heap.nb_allocs - m_heap0.nb_allocs;
+    m_allocated_bytes = heap.allocated_bytes - m_heap0.allocated_bytes;
+    m_peak_bytes = heap.peak_bytes - m_heap0.current_bytes;
+  }
+
+  Runner::Runner(int argc, char** argv)
+  {
+    for(int i = 1 ; i < argc ; i++)
+    {
+      string arg(argv[i]);
+      size_t eq = arg.find('=');
+      string key = arg.substr(0, eq), value = eq == string::npos ? "" : arg.substr(eq + 1);
+
+      if(key == "--format") m_format = value;
+      else if(key == "--output") m_output = value;
+      else if(key == "--filter") m_filter = value;
+      else if(key == "--max-slices") m_max_slices = atol(value.c_str());
+      else if(key == "--max-domains") m_max_domains = atol(value.c_str());
+      else if(key == "--min-time") m_min_time_ms = atof(value.c_str());
+      else
+        cerr << "unknown option: " << arg << endl;
+    }
+
+    if(m_format != "text" && m_format != "json" && m_format != "csv")
+    {
+      cerr << "unknown format: " << m_format << ", text output" << endl;
+      m_format = "text";
+    }
+  }
+
+  vector<long> Runner::slices_sizes() const
+  {
+    vector<long> v;
+    for(long n = 1000 ; n <= m_max_slices ; n *= 10)
+      v.push_back(n);
+    return v;
+  }
+
+  vector<long> Runner::domains_sizes() const
+  {
+    vector<long> v;
+    for(long n = 100 ; n <= m_max_domains ; n *= 10)
+      v.push_back(n);
+    return v;
+  }
+
+  void Runner::run(const string& name, const string& unit, long size, long nb_items,
+                   const function<void(Measure&)>& f)
+  {
+    if(!m_filter.empty() && name.find(m_filter) == string::npos)
+      return;
+
+    double total_ns = 0., total_allocs = 0., total_bytes = 0.;
+    size_t peak_bytes = 0;
+    int nb_runs = 0;
+
+    do
+    {
+      Measure m;
+      f(m);
+      nb_runs++;
+      total_ns += m.m_ns;
+      total_allocs += m.m_nb_allocs;
+      total_bytes += m.m_allocated_bytes;
+      peak_bytes = max(peak_bytes, m.m_peak_bytes);
+    } while(total_ns < m_min_time_ms * 1e6 && nb_runs < 1000);
+
+    Result r;
+    r.name = name;
+    r.unit = unit;
+    r.size = size;
+    r.nb_items = nb_items;
+    r.nb_runs = nb_runs;
+    r.ns_per_item = total_ns / nb_runs / max(1L, nb_items);
+    r.ms_per_run = total_ns / nb_runs / 1e6;
+    r.allocs_per_run = total_allocs / nb_runs;
+    r.bytes_per_run = total_bytes / nb_runs;
+    r.peak_heap_bytes = peak_bytes;
+    r.peak_rss_kb = peak_rss_kb();
+    m_results.push_back(r);
+
+    // Progress, on the error output so that the results can be piped
+    cerr << "  " << name << " (" << size << "): " << r.ns_per_item << " ns/" << unit << endl;
+  }
+
+  int Runner::report() const
+  {
+    ofstream file;
+    if(!m_output.empty())
+    {
+      file.open(m_output);
+      if(!file.is_open())
+      {
+        cerr << "unable to write " << m_output << endl;
+        return EXIT_FAILURE;
+      }
+    }
+
+    ostream& os = m_output.empty() ? cout : file;
+    os << setprecision(6);
+
+    if(m_format == "json")
+    {
+      time_t now = time(NULL);
+      char date[32];
+      strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", gmtime(&now));
+
+      os << "{" << endl
+         << "  \"context\": { \"library\": \"tubex-lib\", \"version\": \"" << TUBEX_BENCH_VERSION << "\", "
+         << "\"date\": \"" << date << "\", \"min_time_ms\": " << m_min_time_ms << ", "
+         << "\"allocs_note\": \"" << ALLOCS_NOTE << "\" }," << endl
+         << "  \"benchmarks\": [" << endl;
+
+      for(size_t i = 0 ; i < m_results.size() ; i++)
+      {
+        const Result& r = m_results[i];
+        os << "    { \"name\": \"" << r.name << "\", \"unit\": \"" << r.unit << "\", "
+           << "\"size\": " << r.size << ", \"items\": " << r.nb_items << ", \"runs\": " << r.nb_runs << ", "
+           << "\"ns_per_item\": " << r.ns_per_item << ", \"ms_per_run\": " << r.ms_per_run << ", "
+           << "\"allocs_per_run\": " << r.allocs_per_run << ", \"bytes_per_run\": " << r.bytes_per_run << ", "
+           << "\"peak_heap_bytes\": " << r.peak_heap_bytes << ", \"peak_rss_kb\": " << r.peak_rss_kb << " }"
+           << (i + 1 < m_results.size() ? "," : "") << endl;
+      }
+
+      os << "  ]" << endl << "}" << endl;
+    }
+
+    else if(m_format == "csv")
+    {
+      os << "name,unit,size,items,runs,ns_per_item,ms_per_run,allocs_per_run,bytes_per_run,peak_heap_bytes,peak_rss_kb" << endl;
+      for(const auto& r : m_results)
+        os << r.name << "," << r.unit << "," << r.size << "," << r.nb_items << "," << r.nb_runs << ","
+           << r.ns_per_item << "," << r.ms_per_run << "," << r.allocs_per_run << "," << r.bytes_per_run << ","
+           << r.peak_heap_bytes << "," << r.peak_rss_kb << endl;
+    }
+
+    else
+    {
+      os << left << setw(28) << "benchmark" << right << setw(9) << "size" << setw(14) << "ns/item"
+         << setw(14) << "allocs/run" << setw(14) << "peak heap kB" << setw(14) << "peak RSS kB" << endl;
+      for(const auto& r : m_results)
+        os << left << setw(28) << r.name << right << setw(9) << r.size
+           << setw(14) << r.ns_per_item << setw(14) << r.allocs_per_run
+           << setw(14) << r.peak_heap_bytes / 1024 << setw(14) << r.peak_rss_kb
+           << "  (" << r.unit << ")" << endl;
+      os << endl << "allocs/run: " << ALLOCS_NOTE << endl;
+    }
+
+    return EXIT_SUCCESS;
+  }
+}
@@ -0,0 +1,150 @@
+/** 
+ *  Benchmark tools
+ * ----------------------------------------------------------------------------
+ *
+ *  \brief      Measurement of computation times, heap allocations and
+ *              memory peaks, and report of the results in text, JSON or CSV.
+ *
+ *  \date       2020
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2020 Simon Rohou
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#ifndef __TUBEX_BENCH_TOOLS_H__
+#define __TUBEX_BENCH_TOOLS_H__
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace bench
+{
+  /**
+   * \brief Heap usage of the program, counted by the replaced operators new/delete
+   *
+   * Classes with their own allocator are only counted when it falls back on
+   * the global operators: the nodes of Paving reused from the free lists
+   * of the threads are not allocations for these statistics.
+   */
+  struct HeapStats
+  {
+    size_t nb_allocs; //!< number of allocations since the beginning of the program
+    size_t allocated_bytes; //!< total of allocated bytes since the beginning of the program
+    size_t current_bytes; //!< bytes currently allocated
+    size_t peak_bytes; //!< peak of allocated bytes since the last reset
+  };
+
+  /**
+   * \brief Returns the current heap statistics
+   */
+  HeapStats heap_stats();
+
+  /**
+   * \brief Sets the heap peak to the current heap usage
+   */
+  void reset_heap_peak();
+
+  /**
+   * \brief Returns the peak resident set size of the process, in kB (-1 if not available)
+   */
+  long peak_rss_kb();
+
+  /**
+   * \brief Result of a benchmark, for a given problem size
+   */
+  struct Result
+  {
+    std::string name; //!< name of the benchmark
+    std::string unit; //!< unit of the work items (slice, domain, query...)
+    long size; //!< size of the problem
+    long nb_items; //!< number of work items processed by one run
+    int nb_runs; //!< number of measured runs
+    double ns_per_item; //!< mean computation time per work item
+    double ms_per_run; //!< mean computation time per run
+    double allocs_per_run; //!< mean number of heap allocations per run
+    double bytes_per_run; //!< mean number of allocated bytes per run
+    size_t peak_heap_bytes; //!< maximal heap increase during a run
+    long peak_rss_kb; //!< peak resident set size of the process after the runs
+  };
+
+  /**
+   * \class Measure
+   * \brief Measured part of a benchmark run, delimited by start() and stop()
+   */
+  class Measure
+  {
+    public:
+
+      void start();
+      void stop();
+
+    protected:
+
+      std::chrono::steady_clock::time_point m_t0;
+      HeapStats m_heap0;
+      double m_ns = 0.;
+      size_t m_nb_allocs = 0, m_allocated_bytes = 0, m_peak_bytes = 0;
+
+      friend class Runner;
+  };
+
+  /**
+   * \class Runner
+   * \brief Runs the benchmarks selected from the command line, and reports their results
+   *
+   * Options:
+   *   --format=text|json|csv   output format (text by default)
+   *   --output=<file>          output file (standard output by default)
+   *   --filter=<string>        only runs the benchmarks whose name contains the string
+   *   --max-slices=<n>         largest number of slices (10^6 by default)
+   *   --max-domains=<n>        largest number of domains (10^5 by default)
+   *   --min-time=<ms>          minimal measured time per benchmark, runs being repeated (200 by default)
+   */
+  class Runner
+  {
+    public:
+
+      Runner(int argc, char** argv);
+
+      /**
+       * \brief Returns the problem sizes from 10^3 to the maximal number of slices
+       */
+      std::vector<long> slices_sizes() const;
+
+      /**
+       * \brief Returns the problem sizes from 10^2 to the maximal number of domains
+       */
+      std::vector<long> domains_sizes() const;
+
+      /**
+       * \brief Runs a benchmark, if selected, until the minimal measured time is reached
+       *
+       * \param name name of the benchmark
+       * \param unit unit of the work items
+       * \param size size of the problem
+       * \param nb_items number of work items processed by one run
+       * \param f run of the benchmark, that prepares its data and calls Measure::start()/stop()
+       */
+      void run(const std::string& name, const std::string& unit, long size, long nb_items,
+               const std::function<void(Measure&)>& f);
+
+      /**
+       * \brief Writes the results in the selected format
+       *
+       * \return `EXIT_SUCCESS`, or `EXIT_FAILURE` if the output file cannot be written
+       */
+      int report() const;
+
+    protected:
+
+      std::string m_format = "text", m_output, m_filter;
+      long m_max_slices = 1000000, m_max_domains = 100000;
+      double m_min_time_ms = 200.;
+      std::vector<Result> m_results;
+  };
+}
+
+#endif
@@ -0,0 +1,233 @@
+/** 
+ *  Benchmark: tubex_bench
+ * ----------------------------------------------------------------------------
+ *
+ *  \brief      Suite of micro-benchmarks (tube operations, contractors,
+ *              serialization) over 10^3 to 10^6 slices, and of macro-benchmarks
+ *              (contractor networks) over 10^2 to 10^5 domains. Reports the
+ *              computation time per slice/domain, the heap allocations and
+ *              the memory peaks, in text, JSON or CSV format.
+ *              Usage: tubex_bench [--format=text|json|csv] [--output=<file>]
+ *                                 [--filter=<name>] [--max-slices=<n>]
+ *                                 [--max-domains=<n>] [--min-time=<ms>]
+ *
+ *  \date       2020
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2020 Simon Rohou
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include "bench_tools.h"
+#include "tubex_Tube.h"
+#include "tubex_CtcDeriv.h"
+#include "tubex_CtcEval.h"
+#include "tubex_CtcFunction.h"
+#include "tubex_ContractorNetwork.h"
+
+using namespace std;
+using namespace ibex;
+using namespace tubex;
+using bench::Measure;
+
+#define BENCH_TUBE_FILE "tubex_bench.tube"
+
+// Tube of n slices over [0,n], with a random-walk envelope
+Tube rand_tube(long n)
+{
+  Tube x(Interval(0.,n), 1.);
+  double y = 0.;
+  for(Slice *s = x.first_slice() ; s != NULL ; s = s->next_slice())
+  {
+    y += (double)rand() / RAND_MAX - 0.5;
+    s->set_envelope(Interval(y - 1., y + 1.));
+  }
+  return x;
+}
+
+void micro_benchmarks(bench::Runner& b)
+{
+  for(long n : b.slices_sizes())
+  {
+    // Tube structure
+
+    b.run("tube/create", "slice", n, n, [n](Measure& m)
+    {
+      m.start();
+      { Tube x(Interval(0.,n), 1., Interval(-1.,1.)); }
+      m.stop();
+    });
+
+    Tube x = rand_tube(n);
+
+    b.run("tube/copy", "slice", n, n, [&x](Measure& m)
+    {
+      m.start();
+      { Tube y(x); }
+      m.stop();
+    });
+
+    b.run("tube/volume", "slice", n, n, [&x](Measure& m)
+    {
+      m.start();
+      volatile double v = x.volume(); (void)v;
+      m.stop();
+    });
+
+    b.run("tube/arithmetic", "slice", n, n, [&x](Measure& m)
+    {
+      m.start();
+      { Tube y = x + Interval(2.) * x; }
+      m.stop();
+    });
+
+    // Evaluations, with the synthesis tree (built outside of the measure)
+
+    const long nb_queries = 10000;
+    b.run("tube/eval_synthesis", "query", n, nb_queries, [&x,n,nb_queries](Measure& m)
+    {
+      x.enable_synthesis(true);
+      x(Interval(0.,n)); // building the tree
+      srand(42);
+      m.start();
+      for(long i = 0 ; i < nb_queries ; i++)
+      {
+        double t = n * ((double)rand() / RAND_MAX);
+        volatile double lb = x(Interval(t, min((double)n, t + n / 100.))).lb(); (void)lb;
+      }
+      m.stop();
+      x.enable_synthesis(false);
+    });
+
+    b.run("tube/integral", "slice", n, n, [&x,n](Measure& m)
+    {
+      m.start();
+      volatile double lb = x.integral(Interval(n / 2.,n)).lb(); (void)lb;
+      m.stop();
+    });
+
+    // Contractors
+
+    b.run("ctc_deriv/contract", "slice", n, n, [n](Measure& m)
+    {
+      Tube x(Interval(0.,n), 1.), v(Interval(0.,n), 1., Interval(-1.,1.));
+      x.set(Interval(0.), 0.);
+      x.set(Interval(0.), (double)n);
+      CtcDeriv ctc_deriv;
+      m.start();
+      ctc_deriv.contract(x, v);
+      m.stop();
+    });
+
+    b.run("ctc_eval/contract", "slice", n, n, [n](Measure& m)
+    {
+      Tube y(Interval(0.,n), 1.), w(Interval(0.,n), 1., Interval(-1.,1.));
+      Interval t(n / 2.), z(-1.,1.);
+      CtcEval ctc_eval;
+      m.start();
+      ctc_eval.contract(t, z, y, w);
+      m.stop();
+    });
+
+    b.run("ctc_eval/contract_batch", "slice", n, n, [n](Measure& m)
+    {
+      Tube y(Interval(0.,n), 1.), w(Interval(0.,n), 1., Interval(-1.,1.));
+      vector<double> v_t;
+      vector<Interval> v_z;
+      for(long i = 0 ; i < n ; i += 10) // one observation every 10 slices
+      {
+        v_t.push_back(i + 0.5);
+        v_z.push_back(Interval(-1.,1.));
+      }
+      CtcEval ctc_eval;
+      m.start();
+      ctc_eval.contract(v_t, v_z, y, w);
+      m.stop();
+    });
+
+    // Serialization
+
+    b.run("tube/serialize", "slice", n, n, [&x](Measure& m)
+    {
+      m.start();
+      x.serialize(BENCH_TUBE_FILE);
+      m.stop();
+    });
+
+    b.run("tube/deserialize", "slice", n, n, [&x](Measure& m)
+    {
+      x.serialize(BENCH_TUBE_FILE);
+      m.start();
+      { Tube y(BENCH_TUBE_FILE); }
+      m.stop();
+    });
+
+    remove(BENCH_TUBE_FILE);
+  }
+}
+
+void macro_benchmarks(bench::Runner& b)
+{
+  for(long n : b.domains_sizes())
+  {
+    // Static network: chain of n additions x_{i+1} = x_i + u_i
+
+    b.run("cn/static_chain", "domain", n, n, [n](Measure& m)
+    {
+      CtcFunction ctc_plus(Function("a", "b", "c", "a+b-c"));
+      vector<Interval> x(n + 1, Interval(-1e6,1e6)), u(n, Interval(0.,1.));
+      x[0] = Interval(0.);
+      x[n] = Interval(n / 2.);
+
+      ContractorNetwork cn;
+      m.start();
+      for(long i = 0 ; i < n ; i++)
+        cn.add(ctc_plus, {x[i], u[i], x[i+1]});
+      cn.contract();
+      m.stop();
+    });
+
+    // Dynamic network: a tube of 1000 slices, with n dated observations.
+    // Each observation reactivates the contractors of the tube: quadratic
+    // cost in the current CN, limited here to 10^3 observations.
+
+    if(n > 1000)
+      continue;
+
+    b.run("cn/dynamic_observations", "domain", n, n, [n](Measure& m)
+    {
+      Tube x(Interval(0.,10.), 0.01), v(Interval(0.,10.), 0.01, Interval(-1.,1.));
+      vector<Interval> v_t(n), v_z(n);
+      srand(42);
+      for(long i = 0 ; i < n ; i++)
+      {
+        v_t[i] = Interval(10. * rand() / RAND_MAX);
+        v_z[i] = Interval(-1.,1.) + sin(v_t[i].mid());
+      }
+
+      CtcDeriv ctc_deriv;
+      CtcEval ctc_eval;
+      ContractorNetwork cn;
+      m.start();
+      cn.add(ctc_deriv, {x, v});
+      for(long i = 0 ; i < n ; i++)
+        cn.add(ctc_eval, {v_t[i], v_z[i], x, v});
+      cn.contract();
+      m.stop();
+    });
+  }
+}
+
+int main(int argc, char** argv)
+{
+  bench::Runner b(argc, argv);
+  srand(42);
+
+  micro_benchmarks(b);
+  macro_benchmarks(b);
+
+  return b.report();
+}
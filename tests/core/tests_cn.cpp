@@ -155,7 +155,7 @@ TEST_CASE("CN simple")
     CHECK(x.codomain() == Interval(-10.,10.));
     CHECK(x.nb_slices() == 4);
     CHECK(v.nb_slices() == 4);
-    CHECK(cn.nb_ctc() == 16);
+    CHECK(cn.nb_ctc() == 13); // one contractor for the rows of slices
     CHECK(cn.nb_dom() == 10);
 
     cn.set_fixedpoint_ratio(0.8);
@@ -457,6 +457,113 @@ TEST_CASE("CN simple")
     //CHECK(x.codomain() == Interval(0.));
   }
 
+  SECTION("Cancellation token")
+  {
+    CtcFunction ctc_plus(Function("a", "b", "c", "a+b-c"));
+    Interval a(0,1), b(-1,1), c(1.5,2);
+
+    ContractorNetwork cn;
+    cn.add(ctc_plus, {a, b, c});
+    CHECK(cn.nb_ctc_in_stack() > 0);
+
+    CancellationToken token;
+    token.cancel();
+    cn.set_cancellation_token(&token);
+    cn.contract();
+
+    CHECK(a == Interval(0,1)); // stopped before any contraction
+    CHECK(cn.nb_ctc_in_stack() > 0);
+
+    token.reset();
+    cn.contract(); // resumed up to the fixed point
+    cn.set_cancellation_token(NULL);
+
+    CHECK(a == Interval(0.5,1));
+    CHECK(b == Interval(0.5,1));
+    CHECK(cn.nb_ctc_in_stack() == 0);
+  }
+
+  SECTION("Static contractor on rows of slices")
+  {
+    Interval tdomain(0.,1000.);
+    Tube x(tdomain, 1., Interval(-10.,10.)), y(tdomain, 1., Interval(0.,1.));
+    Interval a(-1.,1.);
+    CHECK(x.nb_slices() == 1000);
+
+    CtcFunction ctc_plus(Function("x", "y", "a", "x-y-a"));
+
+    ContractorNetwork cn;
+    cn.add(ctc_plus, {x, y, a});
+    cn.add(ctc_plus, {x, y, a}); // redundant contractor that should not be added
+    CHECK(cn.nb_dom() == 2*(1+1000) + 1);
+    CHECK(cn.nb_ctc() == 2*(1+999) + 1); // tubes components, and a single contractor for the rows
+
+    cn.contract();
+    CHECK(x.codomain() == Interval(-1.,2.));
+    CHECK(x(500.) == Interval(-1.,2.));
+    CHECK(cn.nb_ctc_in_stack() == 0);
+
+    // New constraint, propagated through the rows contractors
+    Interval b(0.);
+    cn.add(ctc_plus, {y, x, b}); // y = x
+    cn.contract();
+    CHECK(x.codomain() == Interval(0.,1.));
+    CHECK(y.codomain() == Interval(0.,1.));
+    CHECK(cn.nb_ctc_in_stack() == 0);
+  }
+
+  SECTION("Static contractor on rows of slices, local contractions")
+  {
+    Interval tdomain(0.,1000.);
+    Tube x(tdomain, 1.), v(tdomain, 1., Interval(-1.,1.)), y(tdomain, 1.);
+    y.set(Interval(2.), 500); // only one slice of y is bounded
+
+    CtcFunction ctc_eq(Function("x", "y", "x-y"));
+    CtcDeriv ctc_deriv;
+
+    ContractorNetwork cn;
+    cn.set_fixedpoint_ratio(0.01); // a contraction of one slice is negligible for the whole tube
+    cn.add(ctc_eq, {x, y});
+    cn.add(ctc_deriv, {x, v});
+    cn.contract();
+
+    // CtcDeriv triggered again by the contraction of the row 500
+    CHECK(x(500) == Interval(2.));
+    CHECK(x(499) == Interval(1.,3.));
+    CHECK(x(501) == Interval(1.,3.));
+    CHECK(x(0) == Interval(-498.,502.));
+    CHECK(x(999) == Interval(-497.,501.));
+    CHECK(y(499) == Interval(1.,3.));
+    CHECK(cn.nb_ctc_in_stack() == 0);
+  }
+
+  SECTION("Static contractor on rows of slices, slicing updated after the definition")
+  {
+    Tube x(Interval(0.,4.), 2.), y(Interval(0.,4.), 2., Interval(0.,10.));
+
+    CtcFunction ctc_eq(Function("x", "y", "x-y"));
+
+    ContractorNetwork cn;
+    cn.add(ctc_eq, {x, y});
+    cn.contract();
+    CHECK(x.codomain() == Interval(0.,10.));
+
+    x.sample(1.); x.sample(3.); // x: [0,1],[1,2],[2,3],[3,4]
+    y.sample(1.); // y: [0,1],[1,2],[2,4]
+    x.set(Interval(3.,4.), 0);
+    x.set(Interval(5.,6.), 2);
+
+    cn.trigger_all_contractors();
+    cn.contract();
+
+    CHECK(y(0) == Interval(3.,4.)); // same tdomains
+    CHECK(y(1) == Interval(0.,10.));
+    CHECK(y.slice(1)->input_gate() == Interval(3.,4.));
+    CHECK(y(2) == Interval(0.,10.)); // [2,4]: only partially constrained by x([2,3])
+    CHECK(y.slice(2)->input_gate() == Interval(5.,6.));
+    CHECK(x(3) == Interval(0.,10.));
+  }
+
   /*SECTION("create_dom TubeVector")
   {
     double dt = 0.1;
@@ -64,4 +64,21 @@ TEST_CASE("CtcDelay")
     CHECK(delay.contains(M_PI/2.));
     CHECK(delay.diam() < 3.*dt);
   }
+
+  SECTION("Test CtcDelay, tubes with different slicings")
+  {
+    Interval tdomain(0.,10.);
+    Tube x(tdomain, 0.01, TFunction("cos(t)"));
+    Tube y(tdomain, 0.013, TFunction("sin(t)"));
+
+    CtcDelay ctc_delay;
+    Interval delay(0., 2.*M_PI);
+    ctc_delay.contract(delay, x, y);
+    ctc_delay.contract(delay, x, y);
+
+    CHECK(delay.contains(M_PI/2.));
+    CHECK(delay.diam() < 0.1);
+    CHECK(x(2.).contains(cos(2.)));
+    CHECK(y(2.+M_PI/2.).contains(sin(2.+M_PI/2.)));
+  }
 }
\ No newline at end of file
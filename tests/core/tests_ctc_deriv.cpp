@@ -364,6 +364,91 @@ TEST_CASE("CtcDeriv")
     #endif
   }
 
+  SECTION("Test fwd/bwd from updated slices")
+  {
+    Tube tube(Interval(0.,100.), 1.);
+    Tube tubedot(tube, Interval(-1.,0.5));
+    for(double t = 0. ; t <= 100. ; t += 10.)
+      tube.set(Interval(-1.,1.), t);
+
+    CtcDeriv ctc;
+    ctc.contract(tube, tubedot);
+
+    // Slice far from the update, not consistent on purpose:
+    // a complete contraction would contract it
+    tube.slice(80.5)->set_envelope(Interval(-100.,100.));
+
+    // New measurement at t=55
+    Tube tube_full(tube), tube_fused(tube);
+    tube_full.set(Interval(-0.5,0.), 55.);
+    tube_fused.set(Interval(-0.5,0.), 55.);
+
+    ctc.contract(tube_full, tubedot);
+    ctc.contract(tube_fused, tubedot, Interval(55.));
+
+    CHECK(tube_fused(55.) == Interval(-0.5,0.));
+    CHECK(tube_fused(53.) == Interval(-1.5,2.));
+    CHECK(tube_fused(57.) == Interval(-2.5,1.));
+    for(double t = 0. ; t <= 70. ; t += 0.5)
+      CHECK(tube_fused(t) == tube_full(t));
+
+    // The propagation stopped before t=80
+    CHECK(tube_fused.slice(80.5)->codomain() == Interval(-100.,100.));
+    CHECK(tube_full.slice(80.5)->codomain() != Interval(-100.,100.));
+  }
+
+  SECTION("Test fwd/bwd from updated slices, tube vector")
+  {
+    TubeVector x(Interval(0.,20.), 1., 2);
+    TubeVector v(x, IntervalVector(2, Interval(-1.,0.5)));
+    x.set(IntervalVector(2, Interval(-1.,1.)), 0.);
+
+    CtcDeriv ctc;
+    ctc.contract(x, v);
+
+    TubeVector x_full(x), x_fused(x);
+    IntervalVector y(2);
+    y[0] = Interval(0.,0.5); y[1] = Interval(-3.,-2.);
+    x_full.set(y, 12.);
+    x_fused.set(y, 12.);
+
+    ctc.contract(x_full, v);
+    ctc.contract(x_fused, v, Interval(12.));
+
+    CHECK(x_fused == x_full);
+    CHECK(x_fused(0.)[1] == Interval(-1.,1.));
+    CHECK(x_fused(20.)[0] == Interval(-8.,4.5));
+
+    // Backward only
+    TubeVector x_bwd(x);
+    x_bwd.set(y, 12.);
+    ctc.contract(x_bwd, v, Interval(12.), TimePropag::BACKWARD);
+    CHECK(x_bwd(11.)[0] == Interval(-0.5,1.5));
+    CHECK(x_bwd(14.) == x(14.));
+  }
+
+  SECTION("Test fwd/bwd from updated slices, tolerance")
+  {
+    Tube tube(Interval(0.,10.), 1.);
+    Tube tubedot(tube, Interval(-0.1,0.1));
+    tube.set(Interval(-1.,1.), 0.);
+
+    CtcDeriv ctc;
+    ctc.contract(tube, tubedot);
+
+    tube.set(Interval(-0.95,1.), 2.);
+    Tube tube_eps(tube);
+
+    ctc.contract(tube, tubedot, Interval(2.));
+    CHECK(ApproxIntv(tube(3.)) == Interval(-1.05,1.1));
+    CHECK(ApproxIntv(tube(5.)) == Interval(-1.25,1.3));
+
+    ctc.set_propagation_tolerance(0.5);
+    ctc.contract(tube_eps, tubedot, Interval(2.));
+    CHECK(ApproxIntv(tube_eps(4.)) == Interval(-1.15,1.2));
+    CHECK(ApproxIntv(tube_eps(5.)) == Interval(-1.5,1.5)); // contractions of 0.25 at most: propagation stopped
+  }
+
   SECTION("From: Test slice, output gate contraction")
   {
     Slice x(Interval(-1.,3.), Interval(-5.,3.));
@@ -1074,6 +1074,61 @@ TEST_CASE("CtcEval")
     }
   }
 
+  SECTION("Test CtcEval, batched evaluations")
+  {
+    Tube x(Interval(0.,10.), 0.5, Interval(-10.,10.));
+    Tube v(x, Interval(-1.,1.));
+    Tube x_seq(x), v_seq(v);
+
+    vector<double> v_t;
+    vector<Interval> v_z, v_z_seq;
+    v_t.push_back(1.25); v_z.push_back(Interval(0.,1.));
+    v_t.push_back(4.); v_z.push_back(Interval(2.,2.5));
+    v_t.push_back(7.3); v_z.push_back(Interval(-1.,3.));
+    v_z_seq = v_z;
+
+    CtcEval ctc_eval;
+    ctc_eval.preserve_slicing(false);
+    ctc_eval.contract(v_t, v_z, x, v);
+
+    for(size_t i = 0 ; i < v_t.size() ; i++)
+      ctc_eval.contract(v_t[i], v_z_seq[i], x_seq, v_seq);
+
+    CHECK(Tube::same_slicing(x, x_seq));
+    CHECK(x == ApproxTube(x_seq));
+    CHECK(v == v_seq);
+    CHECK(x(4.) == Interval(2.,2.5));
+    CHECK(ApproxIntv(x(7.3)) == Interval(-1.,3.));
+    for(size_t i = 0 ; i < v_t.size() ; i++)
+      CHECK(v_z[i].is_subset(v_z_seq[i]));
+    CHECK(v_z[0] == Interval(0.,1.));
+    CHECK(ApproxIntv(v_z[2]) == Interval(-1.,3.));
+  }
+
+  SECTION("Test CtcEval, batched evaluations, slicing preserved")
+  {
+    Tube x(Interval(0.,10.), 0.5, Interval(-10.,10.));
+    Tube v(x, Interval(-1.,1.));
+    Tube x_prev(x);
+
+    vector<double> v_t;
+    vector<Interval> v_z;
+    v_t.push_back(1.25); v_z.push_back(Interval(0.,1.));
+    v_t.push_back(4.); v_z.push_back(Interval(2.,2.5));
+    v_t.push_back(7.3); v_z.push_back(Interval(-1.,3.));
+
+    CtcEval ctc_eval; // slicing preserved by default
+    ctc_eval.contract(v_t, v_z, x, v);
+
+    CHECK(x.nb_slices() == x_prev.nb_slices());
+    CHECK(Tube::same_slicing(x, x_prev));
+    CHECK(Tube::same_slicing(x, v));
+    CHECK(x.is_subset(x_prev));
+    CHECK(x(4.) == Interval(2.,2.5));
+    CHECK(x(Interval(7.,7.5)).is_superset(Interval(-1.,3.)));
+    CHECK(x(Interval(7.,7.5)).is_strict_subset(Interval(-10.,10.)));
+  }
+
   SECTION("Test CtcEval, non-zero derivative (negative case)")
   {
     Tube x(Interval(0.,11.), 1.);
@@ -0,0 +1,93 @@
+#include "catch_interval.hpp"
+#include "tubex_CtcFunction.h"
+
+using namespace Catch;
+using namespace Detail;
+using namespace std;
+using namespace ibex;
+using namespace tubex;
+
+TEST_CASE("CtcFunction")
+{
+  // Chain of 20 variables: x_{i+1} = x_i + 1, each component involving two variables
+  const int n = 20;
+  vector<string> v_names;
+  string expr = "(";
+  for(int i = 0 ; i < n ; i++)
+  {
+    v_names.push_back("x" + to_string(i));
+    if(i > 0)
+      expr += (i > 1 ? ";" : "") + v_names[i] + "-" + v_names[i-1] + "-1";
+  }
+  expr += ")";
+
+  vector<const char*> v_args;
+  for(const auto& name : v_names)
+    v_args.push_back(name.c_str());
+  Function f(n, v_args.data(), expr.c_str());
+
+  Interval tdomain(0.,10.);
+  TubeVector x0(tdomain, 1., n);
+  x0[0].set(Interval(0.,0.1));
+
+  SECTION("Sparse mode")
+  {
+    TubeVector x_full(x0), x_sparse(x0);
+
+    CtcFunction ctc_full(f);
+    ctc_full.contract(x_full);
+
+    CtcFunction ctc_sparse(f);
+    ctc_sparse.set_sparse_mode();
+    ctc_sparse.contract(x_sparse);
+
+    // The contractions are propagated until a fixed point in each slice
+    CHECK(x_sparse.is_subset(x_full));
+    for(int i = 0 ; i < n ; i++)
+      CHECK(x_sparse[i](5.).contains(i + 0.05));
+
+    // Propagation of any contraction
+    TubeVector x_fixpoint(x0);
+    CtcFunction ctc_fixpoint(f);
+    ctc_fixpoint.set_sparse_mode();
+    ctc_fixpoint.set_fixedpoint_ratio(0.);
+    ctc_fixpoint.contract(x_fixpoint);
+    CHECK(x_fixpoint.is_subset(x_sparse));
+  }
+
+  SECTION("Sparse mode, unchanged boxes")
+  {
+    TubeVector x(x0);
+
+    CtcFunction ctc(f);
+    ctc.set_sparse_mode();
+    ctc.contract(x);
+
+    TubeVector x_prev(x);
+    ctc.contract(x);
+    CHECK(x == x_prev);
+
+    // Only the updated slice is contracted again
+    x[0].set(Interval(0.), 3);
+    x_prev = x;
+    ctc.contract(x);
+    CHECK(x.is_subset(x_prev));
+    CHECK(x[0](3.5) == Interval(0.));
+    for(int i = 0 ; i < n ; i++)
+    {
+      CHECK(x[i](3.5).contains(i));
+      CHECK(x[i](7.5) == x_prev[i](7.5));
+    }
+  }
+
+  SECTION("Sparse mode, box contracted in another tube")
+  {
+    TubeVector x(x0), y(x0);
+    CtcFunction ctc(f);
+    ctc.set_sparse_mode();
+    ctc.contract(x);
+    ctc.contract(y); // same values: same result
+
+    CHECK(x == y);
+  }
+}
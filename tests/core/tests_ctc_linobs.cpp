@@ -0,0 +1,153 @@
+#include "catch_interval.hpp"
+#include "tubex_CtcLinobs.h"
+
+using namespace Catch;
+using namespace Detail;
+using namespace std;
+using namespace ibex;
+using namespace tubex;
+
+// e^At for the double integrator x=(p,v), dp/dt=v, dv/dt=u
+static IntervalMatrix exp_double_integrator(const Matrix& A, const Interval& t)
+{
+  IntervalMatrix e(2, 2, Interval(0.));
+  e[0][0] = 1.; e[1][1] = 1.;
+  e[0][1] = A[0][1] * t; // A[0][1] = 1 or -1
+  return e;
+}
+
+TEST_CASE("CtcLinobs")
+{
+  Matrix A(2, 2, 0.);
+  A[0][1] = 1.;
+  Vector b(2);
+  b[0] = 0.; b[1] = 1.;
+
+  Interval tdomain(0.,5.);
+  double dt = 0.1;
+  IntervalVector x0(2, Interval(-0.1,0.1));
+
+  SECTION("Incremental mode, first contraction")
+  {
+    TubeVector x(tdomain, dt, 2), x_inc(tdomain, dt, 2);
+    Tube u(tdomain, dt, Interval(-0.1,0.1));
+    x.set(x0, 0.); x_inc.set(x0, 0.);
+
+    CtcLinobs ctc_linobs(A, b, &exp_double_integrator);
+    ctc_linobs.contract(x, u);
+
+    CtcLinobs ctc_linobs_inc(A, b, &exp_double_integrator);
+    ctc_linobs_inc.set_incremental_mode();
+    ctc_linobs_inc.contract(x_inc, u);
+
+    CHECK(!x.codomain().is_unbounded());
+    CHECK(x_inc == x);
+
+    // The next contractions only process the slices contracted in the meantime,
+    // until a fixed point is reached
+    for(int i = 0 ; i < 100 ; i++)
+    {
+      TubeVector x_prev(x_inc);
+      ctc_linobs_inc.contract(x_inc, u);
+      CHECK(x_inc.is_subset(x_prev));
+      if(x_inc == x_prev)
+        break;
+    }
+
+    TubeVector x_fixpoint(x_inc);
+    ctc_linobs_inc.contract(x_inc, u);
+    CHECK(x_inc == x_fixpoint);
+  }
+
+  SECTION("Incremental mode, contracted gates")
+  {
+    TubeVector x(tdomain, dt, 2);
+    Tube u(tdomain, dt, Interval(-0.01,0.01));
+    x.set(x0, 0.);
+
+    CtcLinobs ctc_linobs(A, b, &exp_double_integrator);
+    ctc_linobs.set_incremental_mode();
+    ctc_linobs.contract(x, u);
+
+    // Observation of the position at t=5, for the trajectory x(t)=(0.08t,0.08)
+    IntervalVector y(2);
+    y[0] = Interval(0.35,0.45);
+    y[1] = Interval(-1.,1.);
+    x.set(x(5.) & y, 5.);
+
+    TubeVector x_prev(x);
+    ctc_linobs.contract(x, u);
+
+    CHECK(x.is_subset(x_prev));
+    CHECK(x(5.)[0].is_subset(y[0]));
+    CHECK(x(4.5)[0].diam() < x_prev(4.5)[0].diam()); // propagated to the previous slices
+  }
+
+  SECTION("Incremental mode, enlarged tube")
+  {
+    TubeVector x(tdomain, dt, 2);
+    Tube u(tdomain, dt, Interval(-0.1,0.1));
+    x.set(x0, 0.);
+
+    CtcLinobs ctc_linobs(A, b, &exp_double_integrator);
+    ctc_linobs.set_incremental_mode();
+    ctc_linobs.contract(x, u);
+
+    // The tube is reset: the polygons are computed anew
+    x = TubeVector(tdomain, dt, 2);
+    x.set(IntervalVector(2, Interval(-1.,1.)), 0.);
+    TubeVector x_full(x);
+
+    ctc_linobs.contract(x, u);
+    CtcLinobs(A, b, &exp_double_integrator).contract(x_full, u);
+    CHECK(x == x_full);
+    CHECK(x(5.).is_superset(IntervalVector(2, Interval(-0.5,0.5))));
+  }
+
+  SECTION("Incremental mode, tube reassigned with another slicing")
+  {
+    TubeVector x(Interval(0.,10.), 2.*dt, 2);
+    Tube u(Interval(0.,10.), 2.*dt, Interval(-0.1,0.1));
+    x.set(x0, 0.);
+
+    CtcLinobs ctc_linobs(A, b, &exp_double_integrator);
+    ctc_linobs.set_incremental_mode();
+    ctc_linobs.contract(x, u);
+
+    // Same number of slices, same gates, but over a shorter time step:
+    // the kept polygons do not apply to this tube
+    TubeVector x_new(tdomain, dt, 2);
+    Tube u_new(tdomain, dt, Interval(-0.1,0.1));
+    REQUIRE(x_new.nb_slices() == x.nb_slices());
+    for(int j = 0 ; j < 2 ; j++)
+      for(int i = 0 ; i < x.nb_slices() ; i++)
+      {
+        x_new[j].slice(i)->set_input_gate(x[j].slice(i)->input_gate());
+        x_new[j].slice(i)->set_output_gate(x[j].slice(i)->output_gate());
+      }
+
+    x = x_new; // same objects, at the same addresses
+    u = u_new;
+    TubeVector x_full(x);
+
+    ctc_linobs.contract(x, u);
+    CtcLinobs(A, b, &exp_double_integrator).contract(x_full, u);
+    CHECK(x == x_full);
+    CHECK(x(5.)[0].diam() < x_new(5.)[0].diam());
+  }
+
+  SECTION("Matrix kept by the contractor")
+  {
+    TubeVector x(tdomain, dt, 2), x_ref(tdomain, dt, 2);
+    Tube u(tdomain, dt, Interval(-0.1,0.1));
+    x.set(x0, 0.); x_ref.set(x0, 0.);
+
+    Matrix A_tmp(A);
+    CtcLinobs ctc_linobs(A_tmp, b, &exp_double_integrator);
+    A_tmp[0][1] = -1.; // no effect on the contractor, nor on its exponentials
+    ctc_linobs.contract(x, u);
+
+    CtcLinobs(A, b, &exp_double_integrator).contract(x_ref, u);
+    CHECK(x == x_ref);
+  }
+}
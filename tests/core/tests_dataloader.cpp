@@ -0,0 +1,109 @@
+#include <cstdio>
+#include <clocale>
+#include <fstream>
+#include <sstream>
+#include "catch_interval.hpp"
+#include "tubex_DataLoader.h"
+#include "tubex_Exception.h"
+
+using namespace Catch;
+using namespace Detail;
+using namespace std;
+using namespace ibex;
+using namespace tubex;
+
+class TestDataLoader : public DataLoader
+{
+  public:
+
+    using DataLoader::read_columns;
+};
+
+// Previous loading of the data files, line by line with streams
+static vector<vector<double> > read_columns_by_lines(const string& file_path,
+  int nb_columns, int nb_skipped_lines, int end_line)
+{
+  ifstream file(file_path);
+  vector<vector<double> > v_columns(nb_columns);
+
+  int i = 0;
+  string line;
+  while(getline(file, line))
+  {
+    i++;
+    if(i <= nb_skipped_lines) continue; // accessing data
+    if(i == end_line) break; // end of data
+    if(line.find_first_not_of(" \t\r") == string::npos) continue; // blank line
+
+    istringstream iss(line);
+    iss.imbue(locale::classic());
+    for(int j = 0 ; j < nb_columns ; j++)
+    {
+      double value;
+      iss >> value;
+      REQUIRE(iss);
+      v_columns[j].push_back(value);
+    }
+  }
+
+  return v_columns;
+}
+
+TEST_CASE("DataLoader")
+{
+  const string file_name = "tests_dataloader.txt";
+  {
+    ofstream file(file_name);
+    file << "% header: t x y z" << endl
+         << "% (unused line)" << endl
+         << "0 1.5 -2.25 3e2 extra values" << endl
+         << "  0.5\t+1.25e-1   -0.0 7" << endl
+         << endl // blank line, counted in the lines of the file
+         << "1 1.23456789012345678901234567890123456789012345678901234567890123456789e-3 2 3\r" << endl
+         << "1.5 4 5 6" << endl
+         << "2 7 8 9"; // no newline at the end of the file
+  }
+
+  SECTION("Same values as with the previous loader")
+  {
+    for(int end_line : { -1, 3, 4, 5, 6, 7, 8, 9 })
+    {
+      vector<vector<double> > v_columns = TestDataLoader::read_columns(file_name, 4, 2, end_line);
+      CHECK(v_columns == read_columns_by_lines(file_name, 4, 2, end_line));
+    }
+
+    vector<vector<double> > v_columns = TestDataLoader::read_columns(file_name, 4, 2);
+    REQUIRE(v_columns.size() == 4);
+    CHECK(v_columns[0] == vector<double>({ 0., 0.5, 1., 1.5, 2. }));
+    CHECK(v_columns[1][1] == 0.125);
+    CHECK(v_columns[1][2] == 1.23456789012345678901234567890123456789012345678901234567890123456789e-3); // long token
+    CHECK(v_columns[3] == vector<double>({ 300., 7., 3., 6., 9. }));
+
+    // The cut counts the lines of the file, not the rows of data
+    CHECK(TestDataLoader::read_columns(file_name, 4, 2, 6)[0].size() == 2);
+    CHECK(TestDataLoader::read_columns(file_name, 4, 2, 7)[0].size() == 3);
+  }
+
+  SECTION("Values read in the C locale")
+  {
+    const string prev_locale = setlocale(LC_ALL, NULL);
+    for(const char *name : { "de_DE.UTF-8", "fr_FR.UTF-8", "de_DE", "fr_FR" }) // if installed
+      if(setlocale(LC_ALL, name) != NULL)
+        break; // locale with a decimal comma
+
+    vector<vector<double> > v_columns = TestDataLoader::read_columns(file_name, 4, 2);
+    setlocale(LC_ALL, prev_locale.c_str());
+
+    CHECK(v_columns[1][0] == 1.5);
+    CHECK(v_columns[2][0] == -2.25);
+  }
+
+  SECTION("Errors")
+  {
+    CHECK_THROWS_AS(TestDataLoader::read_columns(file_name, 5, 2), tubex::Exception); // missing values
+    CHECK_THROWS_AS(TestDataLoader::read_columns(file_name, 4, 0), tubex::Exception); // header
+    CHECK_THROWS_AS(TestDataLoader::read_columns("unknown_file.txt", 4, 2), tubex::Exception);
+  }
+
+  remove(file_name.c_str());
+}
@@ -244,6 +244,12 @@ TEST_CASE("Tube definition")
     CHECK(tube_from_boxes.slice(1)->tdomain() == Interval(10.,10.5));
     CHECK(tube_from_boxes.slice(2)->tdomain() == Interval(10.5,12.));
     CHECK(tube_from_boxes.slice(3)->tdomain() == Interval(12.,14.));
+
+    CHECK(tube_from_boxes.tdomains() == v_domains);
+    CHECK(tube_from_boxes.codomains() == v_codomains);
+    CHECK(tube_from_boxes.gates().size() == 5);
+    CHECK(tube_from_boxes.gates()[0] == Interval(3.,4.));
+    CHECK(tube_from_boxes.gates()[4] == Interval(5.5));
   }
 
   SECTION("Tube class - vector of boxes - n-dim case")
@@ -306,5 +312,11 @@ TEST_CASE("Tube definition")
     CHECK(tube_from_boxes[1].slice(1)->tdomain() == Interval(10.,10.5));
     CHECK(tube_from_boxes[1].slice(2)->tdomain() == Interval(10.5,12.));
     CHECK(tube_from_boxes[1].slice(3)->tdomain() == Interval(12.,14.));
+
+    CHECK(tube_from_boxes.tdomains() == v_domains);
+    CHECK(tube_from_boxes.codomains() == v_codomains);
+    CHECK(tube_from_boxes.gates().size() == 5);
+    CHECK(tube_from_boxes.gates()[0] == box1.subvector(1,2));
+    CHECK(tube_from_boxes.gates()[4] == box4.subvector(1,2));
   }
 }
@@ -1,5 +1,10 @@
+#include <thread>
+#include <clocale>
+#include <type_traits>
 #include "catch_interval.hpp"
 #include "tubex_TFunction.h"
+#include "tubex_CtcFunction.h"
+#include "tubex_CtcStatic.h"
 #include "tubex_VIBesFigTube.h"
 
 using namespace Catch;
@@ -49,4 +54,198 @@ TEST_CASE("Functions")
     CHECK(f.arg_name(1) == "x2");
     CHECK(f.expr() == "x1+sin(t)*x2+[-0.01,0.01]");
   }
-}
\ No newline at end of file
+
+  SECTION("Test compiled expression")
+  {
+    TFunction f("x1", "x2", "x1+sin(t)*x2+[-0.01,0.01]");
+    CHECK(f.is_compiled());
+
+    IntervalVector box(3);
+    box[0] = Interval(0.,0.5); box[1] = Interval(1.,2.); box[2] = Interval(-1.,3.);
+    CHECK(ApproxIntv(f.eval(box)) == box[1] + sin(box[0]) * box[2] + Interval(-0.01,0.01));
+
+    // Vector of outputs, common subexpressions evaluated once
+    const char* x[1] = { "x" };
+    IntervalBytecode bc(1, x, "(t*x+1;t*x-1;sqr(t*x))");
+    CHECK(bc.nb_inputs() == 2);
+    CHECK(bc.image_dim() == 3);
+    CHECK(bc.nb_instructions() == 5);
+
+    IntervalVector y = bc.eval_vector(box.subvector(0,1));
+    CHECK(y[0] == box[0] * box[1] + 1.);
+    CHECK(y[1] == box[0] * box[1] - 1.);
+    CHECK(y[2] == sqr(box[0] * box[1]));
+    CHECK(bc[1].image_dim() == 1);
+    CHECK(bc[1].eval_vector(box.subvector(0,1))[0] == y[1]);
+
+    // Decimal constants not exactly representable are enclosed
+    IntervalBytecode bc_cst(0, NULL, "0.1");
+    Interval y_cst = bc_cst.eval_vector(IntervalVector(1, Interval(0.)))[0];
+    CHECK(y_cst.contains(0.1));
+    CHECK(y_cst.diam() > 0.);
+
+    // Constants parsed in the C locale
+    const string prev_locale = setlocale(LC_ALL, NULL);
+    for(const char *name : { "de_DE.UTF-8", "fr_FR.UTF-8", "de_DE", "fr_FR" }) // if installed
+      if(setlocale(LC_ALL, name) != NULL)
+        break; // locale with a decimal comma
+
+    IntervalBytecode bc_locale(0, NULL, "1.5+0.25");
+    setlocale(LC_ALL, prev_locale.c_str());
+    CHECK(bc_locale.eval_vector(IntervalVector(1, Interval(0.)))[0] == Interval(1.75));
+
+    // Evaluation of several boxes in a single pass
+    vector<IntervalVector> v_x(3, box.subvector(0,1)), v_y;
+    v_x[1][0] = Interval(1.,2.);
+    v_x[2].set_empty();
+    bc.eval_vector(v_x, v_y);
+    CHECK(v_y.size() == 3);
+    CHECK(v_y[0] == y);
+    CHECK(v_y[1] == bc.eval_vector(v_x[1]));
+    CHECK(v_y[2].is_empty());
+
+    // Unsupported expressions are still evaluated by ibex
+    TFunction f_unsupported("(11.,11.)");
+    CHECK(!f_unsupported.is_compiled());
+    CHECK_THROWS(IntervalBytecode(0, NULL, "(11.,11.)"));
+  }
+
+  SECTION("Test compiled derivatives and chunked evaluations")
+  {
+    const char* x_name[1] = { "x" };
+    IntervalBytecode bc(1, x_name, "x*(1-x)+sin(t)*x");
+    IntervalBytecode bc_diff = bc.diff();
+    CHECK(bc_diff.nb_inputs() == 2);
+    CHECK(bc_diff.image_dim() == 2);
+
+    IntervalVector box(2);
+    box[0] = Interval(0.,0.5); box[1] = Interval(1.,2.);
+    IntervalVector d = bc_diff.eval_vector(box);
+    CHECK(d[0] == cos(box[0]) * box[1]);
+    CHECK(d[1].is_superset((1. - 2.*box[1]) + sin(box[0])));
+    CHECK(d[1].contains(1. - 2.*1.5 + sin(0.25)));
+    CHECK((d[1] & Interval(-4.,0.5)) == d[1]);
+
+    CHECK(TFunction("x", "x*sin(t)").diff().is_compiled());
+    CHECK(ApproxIntv(TFunction("x", "x*sin(t)").diff().eval_vector(box)[0]) == cos(box[0]) * box[1]);
+    CHECK(!TFunction("x", "abs(x)").diff().is_compiled());
+    CHECK_THROWS(IntervalBytecode(1, x_name, "abs(x)").diff());
+
+    // More boxes than a single chunk of registers
+    vector<IntervalVector> v_x(2*IntervalBytecode::EVAL_CHUNK_SIZE + 10, box), v_y;
+    for(size_t i = 0 ; i < v_x.size() ; i++)
+      v_x[i][0] = Interval(i*0.001);
+    bc.eval_vector(v_x, v_y);
+    REQUIRE(v_y.size() == v_x.size());
+    bool same_values = true;
+    for(size_t i = 0 ; i < v_x.size() ; i++)
+      same_values &= v_y[i] == bc.eval_vector(v_x[i]);
+    CHECK(same_values);
+
+    // Tube of more slices than a single chunk
+    TFunction f("x", "x*(1-x)+sin(t)*x");
+    TubeVector x(1, Tube(Interval(0.,1.5), 0.001, TFunction("t+[-0.01,0.01]")));
+    REQUIRE(x.nb_slices() > (int)IntervalBytecode::EVAL_CHUNK_SIZE);
+    const TubeVector y = f.eval_vector(x);
+    REQUIRE(y.nb_slices() == x.nb_slices());
+
+    same_values = true;
+    const Slice *sx = x[0].first_slice();
+    for(const Slice *sy = y[0].first_slice() ; sy != NULL ; sy = sy->next_slice(), sx = sx->next_slice())
+    {
+      box[0] = sx->tdomain(); box[1] = sx->codomain();
+      same_values &= sy->codomain() == f.eval(box);
+      box[0] = sx->tdomain().lb(); box[1] = sx->input_gate();
+      same_values &= sy->input_gate() == f.eval(box);
+    }
+    CHECK(same_values);
+
+    box[0] = 1.5; box[1] = x[0].last_slice()->output_gate();
+    CHECK(y[0].last_slice()->output_gate() == f.eval(box));
+  }
+
+  SECTION("Test parallel evaluations")
+  {
+    TFunction f("x", "(x+sin(t);x*t)"); // compiled
+    TFunction f_ibex("x", "(11.,11.)"); // evaluated by ibex
+    CtcFunction ctc(Function("x", "y", "x-y"));
+
+    TubeVector x(Interval(0.,10.), 0.1, TFunction("(cos(t))"));
+    x &= TubeVector(Interval(0.,10.), 0.1, IntervalVector(1, Interval(-1.,1.)));
+    const TubeVector y = f.eval_vector(x), y_ibex = f_ibex.eval_vector(x);
+
+    const int nb_threads = 4;
+    vector<TubeVector> v_y(nb_threads, y), v_y_ibex(nb_threads, y_ibex);
+    vector<IntervalVector> v_box(nb_threads, IntervalVector(2, Interval(0.,1.)));
+
+    vector<thread> v_threads;
+    for(int i = 0 ; i < nb_threads ; i++)
+      v_threads.push_back(thread([&](int k)
+        {
+          for(int j = 0 ; j < 10 ; j++)
+          {
+            v_y[k] = f.eval_vector(x);
+            v_y_ibex[k] = f_ibex.eval_vector(x);
+            ctc.contract(v_box[k]);
+          }
+        }, i));
+
+    for(auto& t : v_threads)
+      t.join();
+
+    for(int i = 0 ; i < nb_threads ; i++)
+    {
+      CHECK(v_y[i] == y);
+      CHECK(v_y_ibex[i] == y_ibex);
+      CHECK(v_box[i] == v_box[0]);
+    }
+  }
+
+  SECTION("Test first-order evaluations")
+  {
+    TFunction f("x", "x*(1-x)");
+    IntervalVector box(2);
+    box[0] = Interval(0.); box[1] = Interval(0.,1.);
+
+    const char* x_name[1] = { "x" };
+    IntervalMatrix J = IntervalBytecode(1, x_name, "x*(1-x)").eval_jacobian(box);
+    CHECK(J[0][0] == Interval(0.));
+    CHECK(J[0][1] == Interval(-1.,1.));
+
+    CHECK(f.eval_mode() == EvalMode::NATURAL);
+    CHECK(f.eval(box) == Interval(0.,1.));
+    f.set_eval_mode(EvalMode::MEAN_VALUE);
+    CHECK(f.eval(box) == Interval(0.,0.75)); // 0.25+[-1,1]*[-0.5,0.5]
+    f.set_eval_mode(EvalMode::CENTERED);
+    CHECK(f.eval(box) == Interval(0.,0.5)); // slope: [x]+0.5-1 instead of 1-2[x]
+    CHECK(TFunction(f).eval_mode() == EvalMode::CENTERED);
+
+    // Tighter tubes, at the same slicing
+    TubeVector x(1, Tube(Interval(0.,1.), 0.25, TFunction("t+[-0.01,0.01]")));
+    f.set_eval_mode(EvalMode::NATURAL);
+    Tube y_natural = f.eval(x);
+    f.set_eval_mode(EvalMode::CENTERED);
+    Tube y_centered = f.eval(x);
+
+    CHECK(y_centered.is_subset(y_natural));
+    CHECK(y_centered.volume() < 0.75 * y_natural.volume());
+    for(double t = 0. ; t <= 1. ; t += 0.01)
+      CHECK(y_centered(t).contains(t*(1.-t)));
+  }
+  SECTION("Test copies of contractors and threads")
+  {
+    static_assert(!is_copy_constructible<CtcFunction>::value, "CtcFunction owns the contractors of the threads");
+    static_assert(is_copy_constructible<CtcStatic>::value, "copies of CtcStatic share the IBEX contractor");
+
+    TubeVector x(Interval(0.,10.), 1., 2), x_thread(Interval(0.,10.), 1., 2);
+    x[0].set(Interval(0.,1.)); x_thread[0].set(Interval(0.,1.));
+    CtcFunction ctc(Function("x", "y", "x-y-1"));
+    CtcStatic ctc_static(ctc), ctc_static_copy(ctc_static);
+
+    ctc_static.contract(x);
+    thread t([&]() { ctc_static_copy.contract(x_thread); }); // contraction on a copy of ctc
+    t.join();
+
+    CHECK(x == x_thread);
+  }
+}
@@ -0,0 +1,309 @@
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include "catch_interval.hpp"
+#include "vibes.h"
+#include "tubex_VIBesFigTube.h"
+#include "tubex_VIBesFigPaving.h"
+#include "tubex_SVGBackend.h"
+
+using namespace Catch;
+using namespace Detail;
+using namespace std;
+using namespace ibex;
+using namespace tubex;
+
+static string file_content(const string& file_name)
+{
+  ifstream file(file_name);
+  stringstream content;
+  content << file.rdbuf();
+  return content.str();
+}
+
+static size_t nb_occurrences(const string& s, const string& pattern)
+{
+  size_t nb = 0;
+  for(size_t pos = s.find(pattern) ; pos != string::npos ; pos = s.find(pattern, pos + 1))
+    nb++;
+  return nb;
+}
+
+// Size and viewbox of an SVG image, written in a reserved field of the header
+static string svg_attributes(const string& svg)
+{
+  size_t lb = svg.find("width=");
+  string attributes = svg.substr(lb, svg.find('>', lb) - lb);
+  return attributes.substr(0, attributes.find_last_not_of(' ') + 1);
+}
+
+// Drawing of an SVG image, after the header
+static string svg_drawing(const string& svg)
+{
+  size_t lb = svg.find("<g ");
+  return lb == string::npos ? "" : svg.substr(lb);
+}
+
+class CountingBackend : public vibes::Backend
+{
+  public:
+
+    void message(const vibes::Params&) { nb_messages++; }
+    void flush() { nb_flushes++; }
+
+    int nb_messages = 0, nb_flushes = 0;
+};
+
+// Boxes drawn in the groups of the slices of the figures
+class BoxesBackend : public vibes::Backend
+{
+  public:
+
+    void message(const vibes::Params& msg)
+    {
+      const vibes::Value *shape = msg.find("shape");
+      if(shape == NULL)
+        return;
+
+      const vibes::Params& p = shape->toObject();
+      const vibes::Value *group = p.find("group");
+      if(group == NULL || group->toString().find("_slices") == string::npos)
+        return;
+
+      const string type = p.find("type")->toString();
+      if(type == "box")
+        add_box(*p.find("bounds"));
+      else if(type == "boxes")
+        for(const auto& b : p.find("bounds")->toArray())
+          add_box(b);
+    }
+
+    void add_box(const vibes::Value& bounds)
+    {
+      const vector<vibes::Value>& b = bounds.toArray();
+      IntervalVector box(2);
+      box[0] = Interval(b[0].toDouble(), b[1].toDouble());
+      box[1] = Interval(b[2].toDouble(), b[3].toDouble());
+      v_boxes.push_back(box);
+    }
+
+    vector<IntervalVector> v_boxes;
+};
+
+TEST_CASE("Graphics")
+{
+  SECTION("Scoped batches, ended by exceptions")
+  {
+    const string file_name = "tests_graphics_batch.json";
+    remove(file_name.c_str());
+    vibes::beginDrawing(file_name);
+
+    {
+      vibes::Batch batch;
+      vibes::drawBox(0., 1., 0., 1.);
+      {
+        vibes::Batch nested_batch;
+        vibes::drawBox(1., 2., 1., 2.);
+      }
+      CHECK(file_content(file_name).empty()); // messages buffered until the outermost batch ends
+    }
+    CHECK(nb_occurrences(file_content(file_name), "\"action\":\"draw\"") == 2);
+
+    try
+    {
+      vibes::Batch batch;
+      vibes::drawBox(2., 3., 2., 3.);
+      throw std::runtime_error("error while drawing");
+    }
+    catch(const std::runtime_error&) { }
+    CHECK(nb_occurrences(file_content(file_name), "\"action\":\"draw\"") == 3);
+
+    // The batch is closed: messages are written at once
+    vibes::drawBox(3., 4., 3., 4.);
+    CHECK(nb_occurrences(file_content(file_name), "\"action\":\"draw\"") == 4);
+
+    vibes::endDrawing();
+    remove(file_name.c_str());
+
+    CountingBackend backend;
+    vibes::beginDrawing(&backend);
+    try
+    {
+      vibes::Batch batch;
+      vibes::drawBox(0., 1., 0., 1.);
+      throw std::runtime_error("error while drawing");
+    }
+    catch(const std::runtime_error&) { }
+    CHECK(backend.nb_messages == 1);
+    CHECK(backend.nb_flushes == 1);
+    vibes::endDrawing();
+  }
+
+  SECTION("Tube drawn slice by slice, or aggregated into columns")
+  {
+    Tube x(Interval(0.,10.), 0.01, TFunction("cos(t)+[-0.1,0.1]"));
+    x.set(Interval(-0.5,0.5), Interval(2.,4.)); // not a smooth tube
+    const Tube x_copy(x);
+
+    // Same figure rendered with more pixels than slices, and with less
+
+      BoxesBackend slices_backend;
+      vibes::beginDrawing(&slices_backend);
+      {
+        VIBesFigTube fig("x_slices", &x);
+        fig.set_properties(0, 0, 2000, 500);
+        fig.show(true);
+      }
+      vibes::endDrawing();
+
+      BoxesBackend columns_backend;
+      vibes::beginDrawing(&columns_backend);
+      {
+        VIBesFigTube fig("x_columns", &x);
+        fig.set_properties(0, 0, 200, 500);
+        fig.show(true);
+      }
+      vibes::endDrawing();
+
+    CHECK(slices_backend.v_boxes.size() == (size_t)x.nb_slices());
+    CHECK(columns_backend.v_boxes.size() == 200);
+    CHECK(x == x_copy); // the figure does not modify the tube
+
+    // Each column is the hull of the slices it covers
+
+      for(const auto& column : columns_backend.v_boxes)
+      {
+        IntervalVector hull(2, Interval::EMPTY_SET);
+        for(const auto& slice : slices_backend.v_boxes)
+          if(slice[0].lb() < column[0].ub() && slice[0].ub() > column[0].lb())
+            hull |= slice;
+        CHECK(column[1] == hull[1]);
+        CHECK(hull[0].is_superset(column[0]));
+      }
+
+    // Same overall hull
+
+      IntervalVector hull_slices(2, Interval::EMPTY_SET), hull_columns(2, Interval::EMPTY_SET);
+      for(const auto& b : slices_backend.v_boxes) hull_slices |= b;
+      for(const auto& b : columns_backend.v_boxes) hull_columns |= b;
+      CHECK(hull_slices == hull_columns);
+  }
+
+  SECTION("Tube aggregated into columns")
+  {
+    const string file_name = "tests_graphics_columns.json";
+    remove(file_name.c_str());
+
+    Tube x(Interval(0.,10.), 0.01, Interval(-1.,1.));
+    x.set(Interval(-0.5,0.5), Interval(2.,4.));
+    const Tube x_copy(x);
+
+    vibes::beginDrawing(file_name);
+    {
+      VIBesFigTube fig("x_columns", &x);
+      fig.set_properties(0, 0, 200, 500);
+      fig.show(true); // one box per column, plus the invisible box of the view
+      CHECK(nb_occurrences(file_content(file_name), "\"type\":\"box\"") == 200 + 1);
+
+      fig.show(true); // unchanged columns are not sent again
+      CHECK(nb_occurrences(file_content(file_name), "\"type\":\"box\"") == 200 + 2);
+    }
+    vibes::endDrawing();
+    remove(file_name.c_str());
+
+    CHECK(x == x_copy); // the figure does not modify the tube
+  }
+
+  SECTION("SVG rendering of primitives")
+  {
+    SVGBackend svg(".");
+    vibes::beginDrawing(&svg);
+    vibes::newFigure("tests_svg_primitives");
+    vibes::setFigureProperties("tests_svg_primitives",
+      vibesParams("viewbox", vector<double>({0.,10.,0.,5.}), "width", 400, "height", 200));
+    vibes::drawBox(0., 2., 0., 1., "r[#00FF0080]");
+    vibes::drawBoxes(vector<vector<double> >({{3.,4.,0.,1.},{4.,5.,1.,2.}}), "b[y]");
+    vibes::drawCircle(6., 1., 0.5, "k[w]");
+    vibes::drawLine({0.,1.,2.}, {3.,4.,3.}, "g");
+    vibes::drawPolygon({5.,6.,5.5}, {3.,3.,4.}, "m[c]");
+    vibes::drawPoints({8.,9.}, {1.,2.}, "r");
+    vibes::drawRing(8., 4., 0.5, 1., "k[r]");
+    vibes::endDrawing();
+
+    const string image = file_content("tests_svg_primitives.svg");
+    CHECK(image.find("<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"no\"?>\n"
+                     "<svg xmlns=\"http://www.w3.org/2000/svg\" version=\"1.1\" ") == 0);
+    CHECK(svg_attributes(image) == "width=\"400\" height=\"200\" viewBox=\"0 -5 10 5\" preserveAspectRatio=\"none\"");
+    CHECK(svg_drawing(image) ==
+      "<g transform=\"scale(1,-1)\" fill=\"none\" stroke=\"black\" stroke-width=\"1\" stroke-linejoin=\"round\">\n"
+      "<rect vector-effect=\"non-scaling-stroke\" stroke=\"red\" fill=\"#00FF00\" fill-opacity=\"0.502\" x=\"0\" y=\"0\" width=\"2\" height=\"1\"/>\n"
+      "<path vector-effect=\"non-scaling-stroke\" stroke=\"blue\" fill=\"yellow\" d=\"M3 0H4V1H3ZM4 1H5V2H4Z\"/>\n"
+      "<ellipse vector-effect=\"non-scaling-stroke\" stroke=\"black\" fill=\"white\" cx=\"6\" cy=\"1\" rx=\"0.5\" ry=\"0.5\"/>\n"
+      "<polyline vector-effect=\"non-scaling-stroke\" stroke=\"green\" fill=\"none\" points=\"0,3 1,4 2,3 \"/>\n"
+      "<polygon vector-effect=\"non-scaling-stroke\" stroke=\"magenta\" fill=\"cyan\" points=\"5,3 6,3 5.5,4 \"/>\n"
+      "<path vector-effect=\"non-scaling-stroke\" stroke=\"red\" stroke-width=\"3\" stroke-linecap=\"round\" d=\"M8 1h0M9 2h0\"/>\n"
+      "<path vector-effect=\"non-scaling-stroke\" stroke=\"black\" fill=\"red\" fill-rule=\"evenodd\" "
+        "d=\"M9 4A1 1 0 1 0 7 4A1 1 0 1 0 9 4ZM8.5 4A0.5 0.5 0 1 0 7.5 4A0.5 0.5 0 1 0 8.5 4Z\"/>\n"
+      "</g>\n</svg>\n");
+    remove("tests_svg_primitives.svg");
+  }
+
+  SECTION("SVG rendering of tubes and pavings")
+  {
+    Tube x(Interval(0.,3.), 1., Interval(0.,1.));
+    x.set(Interval(1.,2.), 1);
+
+    Paving p(IntervalVector(2, Interval(0.,1.)));
+    p.bisect(0.5);
+    p.get_first_subpaving()->set_value(SetValue::IN);
+    p.get_second_subpaving()->set_value(SetValue::OUT);
+
+    SVGBackend svg(".");
+    vibes::beginDrawing(&svg);
+    {
+      VIBesFigTube fig("tests_svg_tube", &x);
+      fig.set_properties(0, 0, 300, 200);
+      fig.show(); // polygon envelope, in the style of the tube's group
+    }
+    {
+      VIBesFigTube fig("tests_svg_slices", &x);
+      fig.show(true);
+    }
+    {
+      VIBesFigPaving fig("tests_svg_paving", &p);
+      fig.set_properties(0, 0, 200, 200);
+      fig.show();
+    }
+    vibes::endDrawing();
+
+    string image = file_content("tests_svg_tube.svg");
+    CHECK(svg_attributes(image) == "width=\"300\" height=\"200\" viewBox=\"0 -2 3 2\" preserveAspectRatio=\"none\"");
+    CHECK(svg_drawing(image) ==
+      "<g transform=\"scale(1,-1)\" fill=\"none\" stroke=\"black\" stroke-width=\"1\" stroke-linejoin=\"round\">\n"
+      "<polygon vector-effect=\"non-scaling-stroke\" stroke=\"#a2a2a2\" fill=\"#a2a2a2\" "
+        "points=\"0,1 1,1 1,2 2,2 2,1 3,1 3,0 2,0 2,1 1,1 1,0 0,0 \"/>\n"
+      "<rect vector-effect=\"non-scaling-stroke\" stroke=\"#ffffff\" stroke-opacity=\"0\" fill=\"none\" x=\"0\" y=\"0\" width=\"3\" height=\"2\"/>\n"
+      "</g>\n</svg>\n");
+
+    // Slices gathered in one path, degenerated gates drawn as dots of fixed size
+    image = file_content("tests_svg_slices.svg");
+    CHECK(image.find("<path vector-effect=\"non-scaling-stroke\" stroke=\"#828282\" fill=\"#F0F0F0\" "
+                     "d=\"M0 0H1V1H0ZM1 1H2V2H1ZM2 0H3V1H2Z\"/>\n") != string::npos);
+    CHECK(image.find("<path vector-effect=\"non-scaling-stroke\" stroke=\"#0084AF\" stroke-width=\"2\" "
+                     "stroke-linecap=\"round\" d=\"M1 1h0\"/>\n") != string::npos);
+    CHECK(image.find("<path vector-effect=\"non-scaling-stroke\" stroke=\"#0084AF\" stroke-width=\"2\" "
+                     "stroke-linecap=\"round\" d=\"M2 1h0\"/>\n") != string::npos);
+
+    image = file_content("tests_svg_paving.svg");
+    CHECK(svg_attributes(image) == "width=\"200\" height=\"200\" viewBox=\"0 -1 1 1\" preserveAspectRatio=\"none\"");
+    CHECK(svg_drawing(image) ==
+      "<g transform=\"scale(1,-1)\" fill=\"none\" stroke=\"black\" stroke-width=\"1\" stroke-linejoin=\"round\">\n"
+      "<rect vector-effect=\"non-scaling-stroke\" stroke=\"#ffffff\" stroke-opacity=\"0\" fill=\"none\" x=\"0\" y=\"0\" width=\"1\" height=\"1\"/>\n"
+      "<rect vector-effect=\"non-scaling-stroke\" stroke=\"#9C9C9C\" fill=\"green\" x=\"0\" y=\"0\" width=\"0.5\" height=\"1\"/>\n"
+      "<rect vector-effect=\"non-scaling-stroke\" stroke=\"#9C9C9C\" fill=\"cyan\" x=\"0.5\" y=\"0\" width=\"0.5\" height=\"1\"/>\n"
+      "</g>\n</svg>\n");
+
+    for(const string& file_name : { "tests_svg_tube.svg", "tests_svg_slices.svg", "tests_svg_paving.svg" })
+      remove(file_name.c_str());
+  }
+}
@@ -813,4 +813,29 @@ TEST_CASE("Computing partial integration, two interval bounds", "[core]")
 
     if(TEST_COMPUTATION_TIMES) CHECK(COEFF_COMPUTATION_TIME*t[0] < t[1]);
   }
-}
\ No newline at end of file
+}
+
+TEST_CASE("Computing partial integration with a synthesis tree, after evaluations", "[core]")
+{
+  SECTION("Test tube4, integrals updated after the codomain")
+  {
+    Tube tube = tube_test4();
+    tube.set(Interval(-1,1), Interval(10,11));
+    Tube tube_list(tube);
+    tube.enable_synthesis(true);
+
+    for(int i = 0 ; i < 2 ; i++)
+    {
+      // The values of the tree are synthesized before the integrals
+      CHECK(tube(tube.tdomain()) == tube_list(tube_list.tdomain()));
+
+      CHECK(ApproxIntvPair(tube.partial_integral(Interval(0.9))) == tube_list.partial_integral(Interval(0.9)));
+      CHECK(ApproxIntvPair(tube.partial_integral(Interval(10.1))) == tube_list.partial_integral(Interval(10.1)));
+      CHECK(ApproxIntvPair(tube.partial_integral(Interval(2.,12.6))) == tube_list.partial_integral(Interval(2.,12.6)));
+      CHECK(ApproxIntvPair(tube.partial_integral(Interval(12.6), Interval(14.5))) == tube_list.partial_integral(Interval(12.6), Interval(14.5)));
+
+      tube.set(Interval(-2.,3.), Interval(5.,6.));
+      tube_list.set(Interval(-2.,3.), Interval(5.,6.));
+    }
+  }
+}
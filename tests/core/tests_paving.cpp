@@ -0,0 +1,260 @@
+#include <set>
+#include <list>
+#include "catch_interval.hpp"
+#include "tubex_SIVIAPaving.h"
+#include "tubex_TubePaving.h"
+
+using namespace Catch;
+using namespace Detail;
+using namespace std;
+using namespace ibex;
+using namespace tubex;
+
+static bool same_trees(const Paving *p1, const Paving *p2)
+{
+  if(p1->box() != p2->box() || p1->value() != p2->value() || p1->is_leaf() != p2->is_leaf())
+    return false;
+  return p1->is_leaf()
+    || (same_trees(p1->get_first_subpaving(), p2->get_first_subpaving())
+      && same_trees(p1->get_second_subpaving(), p2->get_second_subpaving()));
+}
+
+static int nb_leaves(const Paving *p)
+{
+  return p->is_leaf() ? 1 : nb_leaves(p->get_first_subpaving()) + nb_leaves(p->get_second_subpaving());
+}
+
+static void bisect_uniformly(Paving *p, int depth)
+{
+  if(depth == 0)
+    return;
+  p->bisect(0.5);
+  bisect_uniformly(p->get_first_subpaving(), depth-1);
+  bisect_uniformly(p->get_second_subpaving(), depth-1);
+}
+
+// Previous implementation of Paving::get_connected_subsets: BFS over the neighbours of the leaves
+static vector<vector<const Paving*> > bfs_connected_subsets(const Paving *paving)
+{
+  paving->reset_flags();
+
+  const Paving *p;
+  SetValue val = SetValue::MAYBE | SetValue::IN;
+  vector<vector<const Paving*> > v_subsets;
+
+  while((p = paving->get_first_leaf(val, true)) != NULL)
+  {
+    vector<const Paving*> v_subset_items;
+    list<const Paving*> l;
+    l.push_back(p);
+
+    while(!l.empty())
+    {
+      const Paving *e = l.front();
+      l.pop_front();
+
+      v_subset_items.push_back(e);
+      e->set_flag();
+
+      vector<const Paving*> v_neighbours;
+      e->get_neighbours(v_neighbours, val, true);
+
+      for(size_t i = 0 ; i < v_neighbours.size() ; i++)
+      {
+        v_neighbours[i]->set_flag();
+        l.push_back(v_neighbours[i]);
+      }
+    }
+
+    v_subsets.push_back(v_subset_items);
+  }
+
+  paving->reset_flags();
+  return v_subsets;
+}
+
+static bool same_subsets(const vector<ConnectedSubset>& v_subsets, const vector<vector<const Paving*> >& v_expected)
+{
+  if(v_subsets.size() != v_expected.size())
+    return false;
+
+  for(size_t i = 0 ; i < v_subsets.size() ; i++)
+  {
+    const vector<const Paving*>& v_items = v_subsets[i].get_items();
+    if(set<const Paving*>(v_items.begin(), v_items.end()) != set<const Paving*>(v_expected[i].begin(), v_expected[i].end()))
+      return false;
+  }
+
+  return true;
+}
+
+// Previous implementation of TubePaving::compute, from the inversion of the tube
+static void inversion_tube_paving(Paving *p, float precision, const TubeVector& x)
+{
+  IntervalVector y = p->box();
+  vector<Interval> v_t_inv;
+  x.invert(y, v_t_inv);
+
+  bool is_out = v_t_inv.empty();
+  bool is_in = false;
+
+  for(size_t i = 0 ; i < v_t_inv.size() && !is_in ; i++)
+  {
+    vector<const Slice*> s(x.size());
+    for(int j = 0 ; j < x.size() ; j++)
+      s[j] = x[j].slice(v_t_inv[i].lb());
+
+    while(!is_in && s[0] != NULL && s[0]->tdomain().ub() <= v_t_inv[i].ub())
+    {
+      bool is_in_i = true;
+
+      for(int j = 0 ; j < x.size() && is_in_i ; j++)
+        is_in_i &= y[j].is_subset(s[j]->codomain());
+
+      is_in |= is_in_i;
+
+      for(int j = 0 ; j < x.size() ; j++)
+        s[j] = s[j]->next_slice();
+    }
+  }
+
+  if(is_out)
+    p->set_value(SetValue::OUT);
+
+  else if(is_in)
+    p->set_value(SetValue::IN);
+
+  else if(p->box().max_diam() < precision)
+    p->set_value(SetValue::MAYBE);
+
+  else
+  {
+    p->bisect();
+    inversion_tube_paving(p->get_first_subpaving(), precision, x);
+    inversion_tube_paving(p->get_second_subpaving(), precision, x);
+  }
+}
+
+TEST_CASE("Paving")
+{
+  SECTION("Parallel SIVIA")
+  {
+    Function f("x", "y", "(x^2+y^2;x*y)");
+    IntervalVector box(2, Interval(-3.,3.));
+    IntervalVector y(2);
+    y[0] = Interval(1.,4.);
+    y[1] = Interval(-1.,2.);
+
+    SIVIAPaving seq(box);
+    seq.compute(f, y, 0.05);
+    CHECK(nb_leaves(&seq) > 1000);
+
+    for(int nb_threads : { 1, 2, 4, 8, 0 })
+    {
+      SIVIAPaving par(box);
+      par.compute(f, y, 0.05, nb_threads);
+      CHECK(same_trees(&seq, &par));
+    }
+  }
+
+  SECTION("Destruction through a pointer to Paving")
+  {
+    Function f("x", "y", "x^2+y^2");
+    IntervalVector box(2, Interval(-3.,3.));
+
+    for(int i = 0 ; i < 3 ; i++) // nodes of the previous pavings are reused
+    {
+      Paving *p = new SIVIAPaving(box);
+      static_cast<SIVIAPaving*>(p)->compute(f, IntervalVector(1, Interval(1.,4.)), 0.1, 4);
+      CHECK(nb_leaves(p) > 100);
+      delete p;
+    }
+  }
+
+  SECTION("Connected subsets")
+  {
+    // Disjoint subsets, and subsets touching by a face or by a corner
+    const char* grid[] = {
+      "XX....X.",
+      "XM...X..",
+      "........",
+      "..XXM...",
+      "....X..X",
+      "X...X...",
+      "........",
+      "XXXXXXXX" };
+
+    Paving p(IntervalVector(2, Interval(0.,8.)), SetValue::OUT);
+    bisect_uniformly(&p, 6);
+
+    vector<const Paving*> v_leaves;
+    p.get_pavings_intersecting(SetValue::OUT, p.box(), v_leaves);
+    CHECK(v_leaves.size() == 64);
+    for(const Paving *leaf : v_leaves)
+    {
+      int col = (int)leaf->box()[0].mid(), row = 7 - (int)leaf->box()[1].mid();
+      char c = grid[row][col];
+      const_cast<Paving*>(leaf)->set_value(c == 'X' ? SetValue::IN : (c == 'M' ? SetValue::MAYBE : SetValue::OUT));
+    }
+
+    vector<ConnectedSubset> v_subsets = p.get_connected_subsets();
+    CHECK(v_subsets.size() == 6);
+    CHECK(same_subsets(v_subsets, bfs_connected_subsets(&p)));
+
+    vector<ConnectedSubset> v_sorted = p.get_connected_subsets(true);
+    CHECK(v_sorted.size() == 6);
+    for(size_t i = 1 ; i < v_sorted.size() ; i++)
+      CHECK(v_sorted[i-1].get_items().size() >= v_sorted[i].get_items().size());
+    CHECK(v_sorted[0].get_items().size() == 8);
+
+    // SIVIA paving with several components
+    Function f("x", "y", "sin(x)*sin(y)");
+    SIVIAPaving sivia(IntervalVector(2, Interval(-5.,5.)));
+    sivia.compute(f, IntervalVector(1, Interval(0.5,1.)), 0.1);
+    v_subsets = sivia.get_connected_subsets();
+    CHECK(v_subsets.size() > 1);
+    CHECK(same_subsets(v_subsets, bfs_connected_subsets(&sivia)));
+  }
+
+  SECTION("Tube paving")
+  {
+    Interval tdomain(0.,10.);
+    TubeVector x(tdomain, 0.1, 2);
+    x[0] = Tube(tdomain, 0.1, TFunction("2*cos(t)+[-0.1,0.1]"));
+    x[1] = Tube(tdomain, 0.1, TFunction("sin(2*t)+[-0.2,0.2]"));
+    IntervalVector box(2, Interval(-3.,3.));
+
+    // Same slicing: the paving is the one of the previous implementation
+
+      TubePaving expected(box);
+      inversion_tube_paving(&expected, 0.05, x);
+
+      TubePaving seq(box), par(box);
+      seq.compute(0.05, x);
+      par.compute(0.05, x, 4);
+      CHECK(same_trees(&seq, &expected));
+      CHECK(same_trees(&par, &expected));
+
+    // Mixed slicing: same paving as with a common slicing
+
+      TubeVector x_mixed(x);
+      x_mixed[1] = Tube(tdomain, 0.25, TFunction("sin(2*t)+[-0.2,0.2]"));
+      x_mixed[1].sample(3.14);
+      REQUIRE_FALSE(Tube::same_slicing(x_mixed[0], x_mixed[1]));
+
+      TubeVector x_common(x_mixed);
+      x_common.sample(x_mixed[0]);
+      x_common.sample(x_mixed[1]);
+      REQUIRE(TubeVector::same_slicing(x_common, x_common[0]));
+
+      TubePaving expected_mixed(box);
+      inversion_tube_paving(&expected_mixed, 0.05, x_common);
+
+      TubePaving seq_mixed(box), par_mixed(box);
+      seq_mixed.compute(0.05, x_mixed);
+      par_mixed.compute(0.05, x_mixed, 4);
+      CHECK(same_trees(&seq_mixed, &expected_mixed));
+      CHECK(same_trees(&par_mixed, &expected_mixed));
+      CHECK_FALSE(same_trees(&seq_mixed, &seq));
+  }
+}
@@ -893,6 +893,63 @@ TEST_CASE("Polygons")
     CHECK(p_truth.is_subset(p_inter) != NO);
   }
 
+  SECTION("Polygons intersections, test 11 (polygons)")
+  {
+    vector<Point> v_points;
+    v_points.push_back(Point(-2.,-2.));
+    v_points.push_back(Point(2.,-2.));
+    v_points.push_back(Point(2.,2.));
+    v_points.push_back(Point(-2.,2.));
+    ConvexPolygon p1(v_points);
+
+    v_points.clear();
+    v_points.push_back(Point(0.,-3.));
+    v_points.push_back(Point(3.,0.));
+    v_points.push_back(Point(0.,3.));
+    v_points.push_back(Point(-3.,0.));
+    ConvexPolygon p2(v_points);
+
+    // Octagon
+    ConvexPolygon p_inter = p1 & p2;
+    CHECK(p_inter.nb_vertices() == 8);
+    CHECK(p_inter.box() == IntervalVector(2,Interval(-2.,2.)));
+    CHECK(p_inter.encloses(Point(1.9,1.9)) == NO);
+    CHECK(p_inter.encloses(Point(1.4,1.4)) == YES);
+
+    // Inclusion
+    ConvexPolygon p3(IntervalVector(2,Interval(-1.,1.)));
+    CHECK((p2 & p3) == p3);
+    CHECK((p3 & p2) == p3);
+
+    // Disjoint polygons
+    ConvexPolygon p4(IntervalVector(2,Interval(5.,6.)));
+    CHECK((p2 & p4).is_empty());
+    CHECK((p4 & p2).is_empty());
+
+    // Many vertices: results enclosing the points that belong to both polygons
+    v_points.clear();
+    for(int i = 0 ; i < 500 ; i++)
+      v_points.push_back(Point(Interval(cos(i*2.*M_PI/500.)), Interval(sin(i*2.*M_PI/500.))));
+    ConvexPolygon p5(v_points);
+
+    v_points.clear();
+    for(int i = 0 ; i < 300 ; i++)
+      v_points.push_back(Point(Interval(0.5+cos(i*2.*M_PI/300.)), Interval(0.2+0.5*sin(i*2.*M_PI/300.))));
+    ConvexPolygon p6(v_points);
+
+    p_inter = p5 & p6;
+    CHECK(p_inter.box().is_subset(p5.box() & p6.box()));
+    for(double x = -1. ; x <= 1.5 ; x += 0.1)
+      for(double y = -1. ; y <= 1. ; y += 0.1)
+      {
+        Point pt(x,y);
+        if(p5.encloses(pt) == YES && p6.encloses(pt) == YES)
+          CHECK(p_inter.encloses(pt) != NO);
+        if(p5.encloses(pt) == NO || p6.encloses(pt) == NO)
+          CHECK(p_inter.encloses(pt) != YES);
+      }
+  }
+
   SECTION("Polygons, orientations")
   {
     IntervalVector p1({0.,0.});
@@ -0,0 +1,136 @@
+#include <atomic>
+#include <thread>
+#include "catch_interval.hpp"
+#include "tubex_ThreadPool.h"
+#include "tubex_Exception.h"
+#include "tubex_async.h"
+#include "tubex_CtcDeriv.h"
+#include "tubex_SIVIAPaving.h"
+
+using namespace Catch;
+using namespace Detail;
+using namespace std;
+using namespace ibex;
+using namespace tubex;
+
+static bool same_pavings(const Paving *p1, const Paving *p2)
+{
+  if(p1->box() != p2->box() || p1->value() != p2->value() || p1->is_leaf() != p2->is_leaf())
+    return false;
+  return p1->is_leaf()
+    || (same_pavings(p1->get_first_subpaving(), p2->get_first_subpaving())
+      && same_pavings(p1->get_second_subpaving(), p2->get_second_subpaving()));
+}
+
+TEST_CASE("ThreadPool")
+{
+  SECTION("Futures and callbacks")
+  {
+    ThreadPool pool(4);
+    CHECK(pool.nb_threads() == 4);
+    CHECK_FALSE(pool.is_worker());
+
+    vector<future<int> > v_results;
+    for(int i = 0 ; i < 100 ; i++)
+      v_results.push_back(pool.async([i]() { return i*i; }));
+    for(int i = 0 ; i < 100 ; i++)
+      CHECK(v_results[i].get() == i*i);
+
+    future<bool> is_worker = pool.async([&pool]() { return pool.is_worker(); });
+    CHECK(is_worker.get());
+
+    future<void> failure = pool.async([]() { throw tubex::Exception("task", "failure"); });
+    CHECK_THROWS(failure.get());
+
+    atomic<int> sum(0);
+    promise<void> done;
+    pool.async([]() { return 42; }, [&sum, &done](int x) { sum += x; done.set_value(); });
+    done.get_future().wait();
+    CHECK(sum == 42);
+  }
+
+  SECTION("Tasks submitted from tasks")
+  {
+    ThreadPool pool(3);
+    atomic<int> nb(0);
+
+    // Recursive splitting of a range, each task submitting its two halves
+    function<void(int,int)> split = [&](int a, int b)
+    {
+      if(b - a == 1)
+        nb++;
+      else
+      {
+        int m = (a + b) / 2;
+        pool.submit([&split, a, m]() { split(a, m); });
+        pool.submit([&split, m, b]() { split(m, b); });
+      }
+    };
+
+    pool.submit([&split]() { split(0, 1000); });
+    pool.set_nb_threads(2); // the tasks already submitted are completed beforehand
+    CHECK(nb == 1000);
+    CHECK(pool.nb_threads() == 2);
+
+    CHECK(pool.async([]() { return 1; }).get() == 1);
+  }
+
+  SECTION("Tasks submitted during a resizing")
+  {
+    ThreadPool pool(2);
+    atomic<int> nb(0);
+
+    thread submitter([&pool, &nb]()
+      {
+        for(int i = 0 ; i < 1000 ; i++)
+          pool.submit([&nb]() { nb++; });
+      });
+
+    for(int nb_threads = 1 ; nb_threads <= 4 ; nb_threads++)
+      pool.set_nb_threads(nb_threads);
+    submitter.join();
+
+    pool.set_nb_threads(2); // waits for the submitted tasks
+    CHECK(nb == 1000);
+  }
+
+  SECTION("Async variants of heavy operations")
+  {
+    Tube x(Interval(0.,10.), 0.01, TFunction("cos(t)+[-0.1,0.1]"));
+    TubeVector x_vec(1, x);
+    TFunction f("x", "(2*x;x)");
+    future<Tube> prim;
+    future<TubeVector> eval;
+
+    {
+      // The arguments are copied: they may be destroyed before the end of the computations
+      Tube x_tmp(x);
+      TubeVector x_vec_tmp(x_vec);
+      TFunction f_tmp(f);
+      prim = async_primitive(x_tmp, Interval(1.));
+      eval = async_eval_vector(f_tmp, x_vec_tmp);
+    }
+
+    CHECK(prim.get() == x.primitive(Interval(1.)));
+    CHECK(eval.get() == f.eval_vector(x_vec));
+
+    Tube y(Interval(0.,10.), 0.01), y_sync(y);
+    y.set(Interval(0.), 0.); y_sync.set(Interval(0.), 0.);
+    CtcDeriv ctc_deriv;
+    future<void> ctc = async_contract(ctc_deriv, y, x, TimePropag::FORWARD);
+    ctc.get(); // ctc_deriv and x are not used concurrently
+    ctc_deriv.contract(y_sync, x, TimePropag::FORWARD);
+    CHECK(y == y_sync);
+  }
+
+  SECTION("Pavings on the global pool")
+  {
+    Function f("x", "y", "x^2+y^2");
+    IntervalVector box(2, Interval(-3.,3.));
+
+    SIVIAPaving seq(box), par(box);
+    seq.compute(f, IntervalVector(1, Interval(1.,4.)), 0.1);
+    par.compute(f, IntervalVector(1, Interval(1.,4.)), 0.1, 0);
+    CHECK(same_pavings(&seq, &par));
+  }
+}
@@ -0,0 +1,45 @@
+#include "catch_interval.hpp"
+#include "tubex_TPlane.h"
+
+using namespace Catch;
+using namespace Detail;
+using namespace std;
+using namespace ibex;
+using namespace tubex;
+
+static bool same_tplanes(const Paving *p1, const Paving *p2)
+{
+  if(p1->box() != p2->box() || p1->value() != p2->value() || p1->is_leaf() != p2->is_leaf())
+    return false;
+  return p1->is_leaf()
+    || (same_tplanes(p1->get_first_subpaving(), p2->get_first_subpaving())
+      && same_tplanes(p1->get_second_subpaving(), p2->get_second_subpaving()));
+}
+
+TEST_CASE("TPlane")
+{
+  SECTION("Loop detections, sequential and parallel")
+  {
+    // Figure-eight trajectory, looping every 2pi
+    Interval tdomain(0.,10.);
+    double dt = 0.01;
+    TubeVector p(tdomain, dt, 2), v(tdomain, dt, 2);
+    p[0] = Tube(tdomain, dt, TFunction("sin(t)+[-0.01,0.01]"));
+    p[1] = Tube(tdomain, dt, TFunction("sin(2*t)+[-0.01,0.01]"));
+    v[0] = Tube(tdomain, dt, TFunction("cos(t)+[-0.01,0.01]"));
+    v[1] = Tube(tdomain, dt, TFunction("2*cos(2*t)+[-0.01,0.01]"));
+
+    TPlane tplane_seq;
+    tplane_seq.compute_detections(0.1, p, v);
+    CHECK(tplane_seq.nb_loops_detections() > 0);
+
+    for(int nb_threads : { 2, 4, 0 })
+    {
+      TPlane tplane_par;
+      tplane_par.set_nb_threads(nb_threads);
+      tplane_par.compute_detections(0.1, p, v);
+      CHECK(same_tplanes(&tplane_seq, &tplane_par));
+      CHECK(tplane_par.nb_loops_detections() == tplane_seq.nb_loops_detections());
+    }
+  }
+}
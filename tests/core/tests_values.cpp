@@ -382,6 +382,32 @@ TEST_CASE("Testing set inversion")
     }
   }
 
+  SECTION("Vector set inversion, with and without synthesis tree")
+  {
+    Tube x = tube_test_1();
+    x.set(Interval(-4,2), 14);
+
+    Interval y[4] = { Interval(0.), Interval(-1.,1.), Interval(3.5), Interval(-4.,-3.) };
+    for(int i = 0 ; i < 4 ; i++)
+    {
+      vector<Interval> v_tree, v_list;
+      x.enable_synthesis(true);
+      x.invert(y[i], v_tree, Interval(3.8,42.5));
+      x.enable_synthesis(false);
+      x.invert(y[i], v_list, Interval(3.8,42.5));
+      CHECK(v_tree == v_list);
+
+      Tube v(x, Interval(-2.,2.));
+      x.enable_synthesis(true);
+      Interval hull_tree = x.invert(y[i], v);
+      x.invert(y[i], v_tree, v);
+      x.enable_synthesis(false);
+      CHECK(hull_tree == x.invert(y[i], v));
+      x.invert(y[i], v_list, v);
+      CHECK(v_tree == v_list);
+    }
+  }
+
   SECTION("Invert method with derivative")
   {
     Tube x(Interval(0., 5.), 1.0);
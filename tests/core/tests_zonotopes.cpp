@@ -0,0 +1,225 @@
+#include "catch_interval.hpp"
+#include "tubex_Zonotope.h"
+#include "tubex_zonotope_arithmetic.h"
+#include "tubex_CtcLinobsZonotope.h"
+
+using namespace Catch;
+using namespace Detail;
+using namespace std;
+using namespace ibex;
+using namespace tubex;
+
+// e^At for the double integrators x=(p,v), dp/dt=v, dv/dt=u, in three dimensions
+IntervalMatrix exp_double_integrators(const Matrix& A, const Interval& t)
+{
+  IntervalMatrix e(6, 6, Interval(0.));
+  for(int i = 0 ; i < 6 ; i++)
+    e[i][i] = 1.;
+  for(int i = 0 ; i < 3 ; i++)
+    e[i][i+3] = A[i][i+3] * t; // A[i][i+3] = 1 or -1
+  return e;
+}
+
+TEST_CASE("Zonotopes")
+{
+  SECTION("Zonotope from box")
+  {
+    IntervalVector box(3);
+    box[0] = Interval(-1.,2.);
+    box[1] = Interval(3.);
+    box[2] = Interval(4.,5.);
+
+    Zonotope z(box);
+    CHECK(z.size() == 3);
+    CHECK(z.nb_generators() == 0);
+    CHECK(z.box() == box);
+    CHECK(!z.is_empty());
+    CHECK(!z.is_unbounded());
+    CHECK(Zonotope(3).is_empty());
+  }
+
+  SECTION("Zonotope, linear map")
+  {
+    double c = sqrt(2.) / 2.;
+    IntervalMatrix rot(2, 2);
+    rot[0][0] = c; rot[0][1] = -c;
+    rot[1][0] = c; rot[1][1] = c;
+
+    Zonotope z = rot * Zonotope(IntervalVector(2, Interval(-1.,1.)));
+    CHECK(z.nb_generators() == 2);
+    CHECK(ApproxIntv(z.box()[0]) == Interval(-sqrt(2.),sqrt(2.)));
+    CHECK(ApproxIntv(z.box()[1]) == Interval(-sqrt(2.),sqrt(2.)));
+
+    // Back to the initial box
+    rot[0][1] = c; rot[1][0] = -c;
+    z = rot * z;
+    CHECK(ApproxIntv(z.box()[0]) == Interval(-1.,1.));
+    CHECK(ApproxIntv(z.box()[1]) == Interval(-1.,1.));
+
+    z = z + IntervalVector(2, Interval(1.,2.));
+    CHECK(ApproxIntv(z.box()[0]) == Interval(0.,3.));
+  }
+
+  SECTION("Zonotope, order reduction")
+  {
+    vector<Vector> v_gen;
+    Vector g(2);
+    g[0] = 1.; g[1] = 0.; v_gen.push_back(g); // aligned with the axes
+    g[0] = 1.; g[1] = 1.; v_gen.push_back(g);
+    g[0] = 1.; g[1] = -0.5; v_gen.push_back(g);
+    g[0] = 0.1; g[1] = 0.1; v_gen.push_back(g);
+    g[0] = -2.; g[1] = 1.; v_gen.push_back(g);
+
+    Zonotope z(IntervalVector(2, Interval(0.)), v_gen);
+    IntervalVector box = z.box();
+    CHECK(z.nb_generators() == 5);
+
+    z.reduce(10);
+    CHECK(z.nb_generators() == 4);
+    CHECK(ApproxIntvVector(z.box()) == box);
+
+    z.reduce(2);
+    CHECK(z.nb_generators() == 2);
+    CHECK(box.is_subset(z.box()));
+  }
+
+  SECTION("Zonotope, intersection with a box")
+  {
+    // p = p0 + 5v, with p0 in [-0.1,0.1] and v in [-1,1]
+    vector<Vector> v_gen;
+    Vector g(2);
+    g[0] = 0.1; g[1] = 0.; v_gen.push_back(g);
+    g[0] = 5.; g[1] = 1.; v_gen.push_back(g);
+    Zonotope z(IntervalVector(2, Interval(0.)), v_gen);
+
+    IntervalVector box(2);
+    box[0] = Interval(-0.01,0.01);
+    box[1] = Interval(); // no information on v
+
+    z &= box;
+    CHECK(!z.is_empty());
+    CHECK(ApproxIntv(z.box()[0]) == Interval(-0.01,0.01));
+    CHECK(ApproxIntv(z.box()[1]) == Interval(-0.022,0.022)); // v = (p-p0)/5
+
+    box[0] = Interval(50.,60.);
+    z &= box;
+    CHECK(z.is_empty());
+  }
+
+  SECTION("Zonotope, unbounded components")
+  {
+    IntervalVector box(2);
+    box[0] = Interval(0.,1.);
+    box[1] = Interval();
+
+    Zonotope z(box);
+    CHECK(z.is_unbounded());
+
+    IntervalMatrix m(2, 2, Interval(1.));
+    z = m * z;
+    CHECK(z.box()[0].is_unbounded());
+
+    box[0] = Interval(-1.,1.);
+    box[1] = Interval(2.,3.);
+    z &= box;
+    CHECK(!z.is_empty());
+    CHECK(z.box().is_subset(box));
+  }
+}
+
+TEST_CASE("CtcLinobsZonotope")
+{
+  // Double integrators in three dimensions: x=(p,v)
+  Matrix A(6, 6, 0.), B(6, 3, 0.);
+  for(int i = 0 ; i < 3 ; i++)
+  {
+    A[i][i+3] = 1.;
+    B[i+3][i] = 1.;
+  }
+
+  Interval tdomain(0.,10.);
+  double dt = 0.1;
+
+  // Truth: constant input
+  Vector p0(3), v0(3), u0(3);
+  p0[0] = 0.05; p0[1] = -0.05; p0[2] = 0.;
+  v0[0] = 0.02; v0[1] = 0.; v0[2] = -0.03;
+  u0[0] = 0.05; u0[1] = -0.1; u0[2] = 0.;
+
+  auto truth = [&](double t)
+  {
+    Vector x(6);
+    for(int i = 0 ; i < 3 ; i++)
+    {
+      x[i] = p0[i] + v0[i] * t + u0[i] * t * t / 2.;
+      x[i+3] = v0[i] + u0[i] * t;
+    }
+    return x;
+  };
+
+  SECTION("Propagation of an initial condition")
+  {
+    TubeVector x(tdomain, dt, 6);
+    TubeVector u(tdomain, dt, IntervalVector(3, Interval(-0.1,0.1)));
+    x.set(IntervalVector(6, Interval(-0.1,0.1)), 0.);
+
+    CtcLinobsZonotope ctc_linobs(A, B, &exp_double_integrators);
+    ctc_linobs.contract(x, u);
+
+    CHECK(!x.codomain().is_unbounded());
+    for(double t = 0. ; t <= 10. ; t += 0.5)
+      CHECK(x(t).contains(truth(t)));
+
+    // Reachable positions at t=10: [-0.1,0.1]+10*[-0.1,0.1]+50*[-0.1,0.1]
+    CHECK(x(10.)[0].is_superset(Interval(-6.1,6.1)));
+    CHECK(x(10.)[0].diam() < 15.);
+    CHECK(x(10.)[3].diam() < 2.5);
+  }
+
+  SECTION("Observations at uncertain states")
+  {
+    TubeVector x(tdomain, dt, 6);
+    TubeVector u(tdomain, dt, IntervalVector(3, Interval(-0.1,0.1)));
+    IntervalVector x0(6, Interval(-0.1,0.1));
+    for(int i = 3 ; i < 6 ; i++)
+      x0[i] = Interval(-10.,10.); // poorly known initial velocities
+    x.set(x0, 0.);
+
+    // Observation of the positions only, at t=5
+    vector<double> v_t(1, 5.);
+    vector<IntervalVector> v_y(1, IntervalVector(6));
+    for(int i = 0 ; i < 3 ; i++)
+      v_y[0][i] = truth(5.)[i] + Interval(-0.01,0.01);
+
+    CtcLinobsZonotope ctc_linobs(A, B, &exp_double_integrators);
+    ctc_linobs.contract(v_t, v_y, x, u);
+
+    for(double t = 0. ; t <= 10. ; t += 0.5)
+      CHECK(x(t).contains(truth(t)));
+
+    // The velocities are deduced from the positions
+    CHECK(v_y[0].contains(truth(5.)));
+    for(int i = 3 ; i < 6 ; i++)
+    {
+      CHECK(v_y[0][i].diam() < 1.);
+      CHECK(x(0.)[i].diam() < 1.);
+    }
+  }
+
+  SECTION("Unbounded initial condition")
+  {
+    TubeVector x(tdomain, dt, 6);
+    TubeVector u(tdomain, dt, IntervalVector(3, Interval(-0.1,0.1)));
+    IntervalVector x0(6, Interval(-0.1,0.1));
+    x0[3] = Interval(); // unknown initial velocity
+    x.set(x0, 0.);
+
+    CtcLinobsZonotope ctc_linobs(A, B, &exp_double_integrators);
+    ctc_linobs.contract(x, u, TimePropag::FORWARD);
+
+    CHECK(x(5.)[0].is_unbounded());
+    CHECK(!x(5.)[1].is_unbounded());
+    for(double t = 0. ; t <= 10. ; t += 0.5)
+      CHECK(x(t).contains(truth(t)));
+  }
+}